@@ -0,0 +1,867 @@
+/***************************************************************
+ * FILE NAME   : bench.cpp
+ * PURPOSE     : Math library benchmarks and checks.
+ *               Run without arguments for all sections or with
+ *               sections names (e.g. 'bench bvh refit').
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* __linux__ */
+
+#include "mth/mth.h"
+
+/* Dual numbers support check: all members of number based classes must compile with them */
+template class mth::vec2<mth::dual<DBL, 3>>;
+template class mth::vec3<mth::dual<DBL, 3>>;
+template class mth::vec4<mth::dual<DBL, 3>>;
+template class mth::matr<mth::dual<DBL, 3>>;
+template class mth::quat<mth::dual<DBL, 3>>;
+template class mth::tensor<mth::dual<DBL, 3>>;
+template class mth::sym_tensor<mth::dual<DBL, 3>>;
+template class mth::ray<mth::dual<DBL, 3>>;
+template class mth::ray_diff<mth::dual<DBL, 3>>;
+template class mth::box<mth::dual<DBL, 3>>;
+template class mth::matn<3, mth::dual<DBL, 3>>;
+template class mth::poly<3, mth::dual<DBL, 3>>;
+template class mth::vec3<mth::dual<FLT>>;
+template class mth::matr<mth::dual<FLT>>;
+template class mth::quat<mth::dual<FLT>>;
+
+/* Compile time noise table check: table is built by compiler into read only data */
+constexpr mth::noise<FLT> ConstNoise;
+static_assert(ConstNoise.TabNoise[0][1] ==
+  []( void )
+  {
+    mth::random::pcg Rnd(mth::noise<FLT>::DEFAULT_SEED);
+
+    Rnd.Unit<FLT>();
+    return Rnd.Unit<FLT>();
+  }(), "Compile time noise table must follow seed sequence");
+static_assert(ConstNoise.TabNoise[255][255] >= 0 && ConstNoise.TabNoise[255][255] < 1, "Noise table values must be in [0, 1)");
+
+/* Benchmarks namespace */
+namespace bench
+{
+  /* Get time in seconds function.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (DBL) seconds from some fixed moment.
+   */
+  inline DBL Time( void )
+  {
+    return std::chrono::duration<DBL>(std::chrono::steady_clock::now().time_since_epoch()).count();
+  } /* End of 'Time' function */
+
+  /* Hardware cache misses counter (Linux perf events) representation type */
+  class cache_counter
+  {
+    int Fd[2] = {-1, -1}; // L1 data cache read misses and last level cache misses events
+
+  public:
+    /* Class constructor (opens events for calling thread) */
+    cache_counter( void )
+    {
+#ifdef __linux__
+      const unsigned long long Configs[2][2] =
+      {
+        {PERF_TYPE_HW_CACHE, PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)},
+        {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES},
+      };
+
+      for (int i = 0; i < 2; i++)
+      {
+        perf_event_attr Attr {};
+
+        Attr.size = sizeof(Attr);
+        Attr.type = static_cast<UINT>(Configs[i][0]);
+        Attr.config = Configs[i][1];
+        Attr.disabled = 1;
+        Attr.exclude_kernel = 1;
+        Attr.exclude_hv = 1;
+        Fd[i] = static_cast<int>(syscall(SYS_perf_event_open, &Attr, 0, -1, -1, 0));
+      }
+#endif /* __linux__ */
+    } /* End of 'cache_counter' function */
+
+    /* Class destructor */
+    ~cache_counter( void )
+    {
+#ifdef __linux__
+      for (const int F : Fd)
+        if (F >= 0)
+          close(F);
+#endif /* __linux__ */
+    } /* End of '~cache_counter' function */
+
+    /* Check if counters are available function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (bool) true if both events are counted.
+     */
+    bool IsValid( void ) const
+    {
+      return Fd[0] >= 0 && Fd[1] >= 0;
+    } /* End of 'IsValid' function */
+
+    /* Count events of function call.
+     * ARGUMENTS:
+     *   - function to run:
+     *       const Func &F;
+     *   - L1 data cache and last level cache misses:
+     *       long long &L1, &LL;
+     * RETURNS: None.
+     */
+    template<typename Func>
+      void Count( const Func &F, long long &L1, long long &LL ) const
+      {
+        long long Counts[2] = {-1, -1};
+
+#ifdef __linux__
+        for (const int Fe : Fd)
+          if (Fe >= 0)
+          {
+            ioctl(Fe, PERF_EVENT_IOC_RESET, 0);
+            ioctl(Fe, PERF_EVENT_IOC_ENABLE, 0);
+          }
+        F();
+        for (int i = 0; i < 2; i++)
+          if (Fd[i] >= 0)
+          {
+            ioctl(Fd[i], PERF_EVENT_IOC_DISABLE, 0);
+            if (read(Fd[i], &Counts[i], sizeof(Counts[i])) != sizeof(Counts[i]))
+              Counts[i] = -1;
+          }
+#else /* __linux__ */
+        F();
+#endif /* __linux__ */
+        L1 = Counts[0];
+        LL = Counts[1];
+      } /* End of 'Count' function */
+  }; /* End of 'cache_counter' class */
+
+  /* Noise displaced spheres triangle scene representation type */
+  struct scene
+  {
+    std::vector<mth::vec3<FLT>> V0, V1, V2; // Triangles vertices
+    std::vector<mth::box<FLT>> Boxes;       // Triangles bounding boxes
+
+    /* Scene constructor.
+     * ARGUMENTS:
+     *   - spheres grid size (Size^2 spheres):
+     *       const int Size;
+     *   - sphere mesh longitude segments (half as many latitude ones):
+     *       const int Res;
+     */
+    scene( const int Size, const int Res )
+    {
+      const mth::hash_noise<FLT> Noise;
+      const int ResV = Res / 2;
+      std::vector<mth::vec3<FLT>> Grid((Res + 1) * (ResV + 1));
+
+      for (int s = 0; s < Size * Size; s++)
+      {
+        const mth::vec3<FLT> C(static_cast<FLT>(s % Size * 3), static_cast<FLT>(s / Size * 3), 0);
+
+        for (int j = 0; j <= ResV; j++)
+          for (int i = 0; i <= Res; i++)
+          {
+            const FLT
+              Phi = static_cast<FLT>(2 * mth::PI * i / Res),
+              Theta = static_cast<FLT>(mth::PI * j / ResV);
+            const mth::vec3<FLT> D(std::sin(Theta) * std::cos(Phi), std::sin(Theta) * std::sin(Phi), std::cos(Theta));
+
+            Grid[j * (Res + 1) + i] = C + D * (1 + static_cast<FLT>(0.3) * Noise.Fbm(D * 3 + C, 4));
+          }
+        for (int j = 0; j < ResV; j++)
+          for (int i = 0; i < Res; i++)
+          {
+            const mth::vec3<FLT>
+              &P00 = Grid[j * (Res + 1) + i], &P10 = Grid[j * (Res + 1) + i + 1],
+              &P01 = Grid[(j + 1) * (Res + 1) + i], &P11 = Grid[(j + 1) * (Res + 1) + i + 1];
+
+            Add(P00, P10, P11);
+            Add(P00, P11, P01);
+          }
+      }
+    } /* End of 'scene' function */
+
+    /* Add triangle function.
+     * ARGUMENTS:
+     *   - triangle vertices:
+     *       const mth::vec3<FLT> &P0, &P1, &P2;
+     * RETURNS: None.
+     */
+    void Add( const mth::vec3<FLT> &P0, const mth::vec3<FLT> &P1, const mth::vec3<FLT> &P2 )
+    {
+      V0.push_back(P0);
+      V1.push_back(P1);
+      V2.push_back(P2);
+      Boxes.push_back(mth::box<FLT>(P0.Min(P1).Min(P2), P0.Max(P1).Max(P2)));
+    } /* End of 'Add' function */
+
+    /* Intersect triangle function (bvh primitive callback).
+     * ARGUMENTS:
+     *   - triangle index:
+     *       const int P;
+     *   - ray to intersect:
+     *       const mth::ray<FLT> &R;
+     * RETURNS:
+     *   (FLT) distance to intersection (-1 if no intersection).
+     */
+    FLT operator()( const int P, const mth::ray<FLT> &R ) const noexcept
+    {
+      FLT U, V;
+
+      return R.IntersectTriangle(V0[P], V1[P], V2[P], U, V);
+    } /* End of 'operator()' function */
+  }; /* End of 'scene' structure */
+
+  /* BVH build and trace benchmark function.
+   * Closest hit and occlusion primary rays are traced through
+   * noise displaced spheres (no external assets needed).
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (bool) true (benchmark has no checks).
+   */
+  inline bool Bvh( void )
+  {
+    const scene Scene(4, 256);
+    const int Count = static_cast<int>(Scene.Boxes.size()), W = 1024, H = 768;
+
+    DBL T0 = Time();
+    const mth::bvh<FLT> Tree(Scene.Boxes.data(), Count);
+    const DBL BuildTime = Time() - T0;
+
+    const mth::vec3<FLT> Org(static_cast<FLT>(4.5), static_cast<FLT>(4.5), 10);
+    const auto Primary =
+      [&]( const int X, const int Y )
+      {
+        return mth::ray<FLT>(Org, mth::vec3<FLT>(static_cast<FLT>(X - W / 2) / H, static_cast<FLT>(H / 2 - Y) / H, -1));
+      };
+    std::vector<int> Hits(H), Occluded(H);
+
+    T0 = Time();
+    mth::parallel::For(0, H,
+      [&]( const int Begin, const int End, const int )
+      {
+        for (int y = Begin; y < End; y++)
+          for (int x = 0; x < W; x++)
+          {
+            mth::bvh<FLT>::hit Hit {std::numeric_limits<FLT>::max(), -1};
+
+            Hits[y] += Tree.Intersect(Primary(x, y), Hit, Scene);
+          }
+      });
+    const DBL ClosestTime = Time() - T0;
+
+    T0 = Time();
+    mth::parallel::For(0, H,
+      [&]( const int Begin, const int End, const int )
+      {
+        for (int y = Begin; y < End; y++)
+          for (int x = 0; x < W; x++)
+            Occluded[y] += Tree.Occluded(Primary(x, y), 0, std::numeric_limits<FLT>::max(), Scene);
+      });
+    const DBL AnyTime = Time() - T0;
+    int HitCount = 0, OccludedCount = 0;
+
+    for (int y = 0; y < H; y++)
+      HitCount += Hits[y], OccludedCount += Occluded[y];
+    std::printf("bvh: %d triangles, %d threads, build %.1f ms (SAH cost %.1f)\n",
+      Count, mth::parallel::ThreadsCount(), BuildTime * 1000, Tree.TreeCost);
+    std::printf("bvh: closest hit %.2f Mrays/s (%d hits), any hit %.2f Mrays/s (%d hits)\n",
+      W * H / ClosestTime * 1e-6, HitCount, W * H / AnyTime * 1e-6, OccludedCount);
+    return true;
+  } /* End of 'Bvh' function */
+
+  /* Diffuse rays stream benchmark function.
+   * Primary rays hits spawn random diffuse bounce rays, shuffled to model
+   * incoherent batch (e.g. random pixels sampling). They are traced by one
+   * thread (cache counters are per thread) in adding order, after
+   * 'ray_stream::Sort' (sort time included) and by breadth-first
+   * 'IntersectStream' over sorted rays.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (bool) true if all traversals find same hits.
+   */
+  inline bool Stream( void )
+  {
+    const scene Scene(4, 256);
+    const mth::bvh<FLT> Tree(Scene.Boxes.data(), static_cast<int>(Scene.Boxes.size()));
+    const int W = 1024, H = 768;
+    const mth::vec3<FLT> Org(static_cast<FLT>(4.5), static_cast<FLT>(4.5), 10);
+    const cache_counter Counter;
+    mth::random::pcg Rnd(33);
+    std::vector<mth::ray<FLT>> Rays;
+    mth::ray_stream<FLT> Stream;
+
+    for (int y = 0; y < H; y++)
+      for (int x = 0; x < W; x++)
+      {
+        const mth::ray<FLT> R(Org, mth::vec3<FLT>(static_cast<FLT>(x - W / 2) / H, static_cast<FLT>(H / 2 - y) / H, -1));
+        mth::bvh<FLT>::hit Hit {std::numeric_limits<FLT>::max(), -1};
+
+        if (!Tree.Intersect(R, Hit, Scene))
+          continue;
+
+        /* Random direction in hemisphere facing incoming ray */
+        mth::vec3<FLT> N = ((Scene.V1[Hit.Prim] - Scene.V0[Hit.Prim]) % (Scene.V2[Hit.Prim] - Scene.V0[Hit.Prim])).Normalizing(), D;
+
+        if ((N & R.Dir) > 0)
+          N = -N;
+        do
+          D = mth::vec3<FLT>(Rnd.Unit<FLT>(), Rnd.Unit<FLT>(), Rnd.Unit<FLT>()) * 2 - mth::vec3<FLT>(1);
+        while ((D & D) > 1 || (D & D) < static_cast<FLT>(1e-4));
+        if ((D & N) < 0)
+          D = -D;
+        Rays.push_back(mth::ray<FLT>(R.Org + R.Dir * Hit.T + N * static_cast<FLT>(1e-3), D.Normalizing()));
+      }
+    for (int i = static_cast<int>(Rays.size()) - 1; i > 0; i--)
+      std::swap(Rays[i], Rays[Rnd.Next() % (i + 1)]);
+    for (const mth::ray<FLT> &R : Rays)
+      Stream.Add(R);
+
+    const int Count = Stream.Size();
+    const mth::bvh<FLT>::hit Init {std::numeric_limits<FLT>::max(), -1};
+    std::vector<mth::bvh<FLT>::hit> Unsorted(Count, Init), Sorted(Count, Init), Streamed(Count, Init), Tmp(Count, Init);
+
+    std::printf("stream: %d diffuse rays, %zu triangles%s\n", Count, Scene.Boxes.size(),
+      Counter.IsValid() ? "" : " (cache miss counters are not available)");
+
+    const auto Run =
+      [&]( const char *Case, const auto &Trace )
+      {
+        long long L1, LL;
+        const DBL T0 = Time();
+
+        Counter.Count(Trace, L1, LL);
+        const DBL T = Time() - T0;
+
+        if (L1 >= 0 && LL >= 0)
+          std::printf("stream: %-22s %6.0f ns/ray, %6.2f L1 misses/ray, %6.3f LLC misses/ray\n",
+            Case, T * 1e9 / Count, static_cast<DBL>(L1) / Count, static_cast<DBL>(LL) / Count);
+        else
+          std::printf("stream: %-22s %6.0f ns/ray\n", Case, T * 1e9 / Count);
+      };
+
+    Run("per ray unsorted",
+      [&]( void )
+      {
+        for (int i = 0; i < Count; i++)
+          Tree.Intersect(Rays[i], Unsorted[i], Scene);
+      });
+    Run("per ray sorted + sort",
+      [&]( void )
+      {
+        Stream.Sort();
+        for (int i = 0; i < Count; i++)
+          Tree.Intersect(Stream.Rays[i], Tmp[i], Scene);
+      });
+    Stream.Scatter(Tmp.data(), Sorted.data());
+    std::fill(Tmp.begin(), Tmp.end(), Init);
+    Run("stream sorted",
+      [&]( void )
+      {
+        Tree.IntersectStream(Stream.Rays.data(), Count, Tmp.data(), Scene);
+      });
+    Stream.Scatter(Tmp.data(), Streamed.data());
+
+    int Diff = 0;
+
+    for (int i = 0; i < Count; i++)
+      Diff += Unsorted[i].Prim != Sorted[i].Prim || Unsorted[i].Prim != Streamed[i].Prim;
+    std::printf("stream: %d rays differ between traversals\n", Diff);
+    return Diff == 0;
+  } /* End of 'Stream' function */
+
+  /* BVH refit under gradual motion check function.
+   * Half of spheres jitters (its units are rebuilt often and nodes array
+   * is relaid out), other half slowly spreads. Units SAH costs are tracked
+   * since their last rebuild (detected by changed primitives order):
+   * no unit may drift more than threshold times without rebuild.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (bool) true if units drift is bounded and tree is valid.
+   */
+  inline bool Refit( void )
+  {
+    const scene Scene(4, 64);
+    const int Count = static_cast<int>(Scene.Boxes.size()), Slow = Count / 2, Frames = 300;
+    const FLT Threshold = static_cast<FLT>(1.3);
+    mth::random::pcg Rnd(1);
+    std::vector<mth::vec3<FLT>> Dir(Count);
+    std::vector<mth::box<FLT>> Boxes(Scene.Boxes);
+
+    for (mth::vec3<FLT> &D : Dir)
+      D = mth::vec3<FLT>(Rnd.Unit<FLT>(), Rnd.Unit<FLT>(), Rnd.Unit<FLT>()) * 2 - mth::vec3<FLT>(1);
+
+    mth::bvh<FLT> Tree(Boxes.data(), Count);
+    std::vector<FLT> BaseCost(Count, -1);  // Units costs after last rebuild (by first primitive)
+    std::vector<int> BaseCount(Count, 0);  // Units primitives counts (by first primitive)
+    std::vector<int> Ind(Tree.Ind);
+    int Rebuilds = 0, SlowRebuilds = 0, FullBuilds = 0;
+    FLT MaxDrift = 0;
+    DBL RefitTime = 0;
+
+    for (int f = 0; f <= Frames; f++)
+    {
+      if (f > 0)
+      {
+        for (int i = 0; i < Count; i++)
+        {
+          const FLT Shift = i < Slow ?
+            static_cast<FLT>(0.0004) * f :
+            static_cast<FLT>(0.05) * std::sin(static_cast<FLT>(0.3) * f + i);
+          const mth::vec3<FLT> S = Dir[i] * Shift;
+
+          Boxes[i] = mth::box<FLT>(Scene.Boxes[i].Min + S, Scene.Boxes[i].Max + S);
+        }
+
+        const int Units = static_cast<int>(Tree.Subtrees.size());
+        const DBL T0 = Time();
+        const int N = Tree.Refit(Boxes.data(), Threshold);
+
+        RefitTime += Time() - T0;
+        Rebuilds += N;
+        FullBuilds += N == Units;
+      }
+      for (const mth::bvh<FLT>::subtree &S : Tree.Subtrees)
+      {
+        bool IsRebuilt = BaseCount[S.First] != S.Count, IsSlow = true;
+
+        for (int i = S.First; i < S.First + S.Count; i++)
+        {
+          IsRebuilt |= Ind[i] != Tree.Ind[i];
+          IsSlow &= Tree.Ind[i] < Slow;
+        }
+        if (IsRebuilt)
+        {
+          BaseCost[S.First] = Tree.Cost(S.Node);
+          BaseCount[S.First] = S.Count;
+          SlowRebuilds += f > 0 && IsSlow;
+        }
+        else
+          MaxDrift = std::max(MaxDrift, Tree.Cost(S.Node) / BaseCost[S.First]);
+      }
+      Ind = Tree.Ind;
+    }
+
+    /* Validate refitted tree: every reachable node contains its children and primitives */
+    const auto Contains =
+      [&]( const mth::bvh<FLT>::node &Nd, const mth::vec3<FLT> &Min, const mth::vec3<FLT> &Max )
+      {
+        return Nd.Min[0] <= Min[0] && Nd.Min[1] <= Min[1] && Nd.Min[2] <= Min[2] &&
+               Max[0] <= Nd.Max[0] && Max[1] <= Nd.Max[1] && Max[2] <= Nd.Max[2];
+      };
+    std::vector<UINT> Stack {0};
+    bool IsValid = true;
+    int Reached = 0;
+
+    while (!Stack.empty())
+    {
+      const mth::bvh<FLT>::node &Nd = Tree.Nodes[Stack.back()];
+      const UINT Left = Stack.back() + 1;
+
+      Stack.pop_back();
+      if (Nd.IsLeaf())
+      {
+        for (UINT i = 0; i < Nd.Count; i++)
+          IsValid &= Contains(Nd, Boxes[Tree.Ind[Nd.Offset + i]].Min, Boxes[Tree.Ind[Nd.Offset + i]].Max);
+        Reached += Nd.Count;
+        continue;
+      }
+      for (const UINT C : {Left, Nd.Offset})
+      {
+        IsValid &= Contains(Nd, Tree.Nodes[C].Min, Tree.Nodes[C].Max);
+        Stack.push_back(C);
+      }
+    }
+    IsValid &= Reached == Count;
+
+    std::printf("bvh refit: %d frames, %.3f ms/frame, %d units rebuilt, %d full builds\n",
+      Frames, RefitTime * 1000 / Frames, Rebuilds, FullBuilds);
+    std::printf("bvh refit: %d slowly moving units rebuilt, max unit cost growth without rebuild %.2f (threshold %.2f)\n",
+      SlowRebuilds, MaxDrift, Threshold);
+    return IsValid && SlowRebuilds > 0 && MaxDrift <= Threshold * static_cast<FLT>(1.001);
+  } /* End of 'Refit' function */
+
+  /* Quartic solver accuracy check for one precision function.
+   * Random quartics are made of 4 real roots, 2 real roots and complex pair
+   * or 2 complex pairs. Roots are dyadic numbers in [-4, 4] with few enough
+   * bits to make all coefficients exactly representable, so made roots and
+   * roots counts are exact oracle.
+   * ARGUMENTS:
+   *   - precision name:
+   *       const char *Name;
+   *   - maximal 99.99% quantile of roots relative error:
+   *       const Type MaxError;
+   * RETURNS:
+   *   (bool) true if all roots counts are right and errors are small.
+   */
+  template<typename Type>
+    inline bool QuarticType( const char *Name, const Type MaxError )
+    {
+      using LDBL = long double;
+      const int Num = 1 << 18;
+      const LDBL Step = std::ldexp(static_cast<LDBL>(1), -(std::numeric_limits<Type>::digits - 8) / 4 + 1);
+      mth::random::pcg Rnd(38);
+      std::vector<Type> K[5], S[4];
+      std::vector<LDBL> Oracle[4];
+      std::vector<int> Count(Num), OracleCount(Num);
+
+      for (int i = 0; i < 5; i++)
+        K[i].resize(Num);
+      for (int i = 0; i < 4; i++)
+        S[i].resize(Num), Oracle[i].resize(Num);
+
+      for (int n = 0; n < Num; n++)
+      {
+        const auto Unit = [&]( void ) { return std::round((static_cast<LDBL>(Rnd.Unit<DBL>()) * 8 - 4) / Step) * Step; };
+        const int Real = 4 - n % 3 * 2;
+        LDBL R[4], P[5] = {1, 0, 0, 0, 0}; // Roots and monic polynomial (highest power first)
+
+        /* Real roots are kept apart (well conditioned) */
+        for (int i = 0; i < Real; i++)
+        {
+          bool IsNear;
+
+          do
+          {
+            R[i] = Unit();
+            IsNear = false;
+            for (int j = 0; j < i; j++)
+              IsNear |= std::abs(R[i] - R[j]) < static_cast<LDBL>(0.125);
+          } while (IsNear);
+        }
+        for (int i = 0; i < 4; i++)
+        {
+          /* Multiply by (x - r) or by complex pair (x - a) ^ 2 + b ^ 2 */
+          if (i < Real)
+            for (int j = i + 1; j > 0; j--)
+              P[j] -= R[i] * P[j - 1];
+          else if ((i - Real) % 2 == 0)
+          {
+            const LDBL A = Unit(), B = std::max(std::abs(Unit()), static_cast<LDBL>(0.125)), Q1 = -2 * A, Q0 = A * A + B * B;
+
+            for (int j = i + 2; j > 0; j--)
+              P[j] += Q1 * P[j - 1] + (j > 1 ? Q0 * P[j - 2] : 0);
+          }
+        }
+
+        /* Power of 2 scale keeps coefficients exact */
+        const LDBL Scale = std::ldexp(static_cast<LDBL>(1), static_cast<int>(Rnd.Next() % 5) - 2);
+
+        for (int i = 0; i < 5; i++)
+        {
+          K[i][n] = static_cast<Type>(P[i] * Scale);
+          if (K[i][n] != P[i] * Scale)
+          {
+            std::printf("quartic %s: inexact coefficient\n", Name);
+            return false;
+          }
+        }
+        std::sort(R, R + Real);
+        for (int i = 0; i < Real; i++)
+          Oracle[i][n] = R[i];
+        OracleCount[n] = Real;
+      }
+
+      const DBL T0 = Time();
+      mth::solver::QuarticSolver(K[0].data(), K[1].data(), K[2].data(), K[3].data(), K[4].data(),
+        S[0].data(), S[1].data(), S[2].data(), S[3].data(), Count.data(), Num);
+      const DBL SolveTime = Time() - T0;
+
+      std::vector<LDBL> Errors;
+      int Wrong = 0;
+
+      for (int n = 0; n < Num; n++)
+        if (Count[n] != OracleCount[n])
+          Wrong++;
+        else
+          for (int i = 0; i < Count[n]; i++)
+            Errors.push_back(std::abs(S[i][n] - Oracle[i][n]) / std::max(static_cast<LDBL>(1), std::abs(Oracle[i][n])));
+      std::sort(Errors.begin(), Errors.end());
+
+      const auto Quantile = [&]( const DBL Q ) { return static_cast<DBL>(Errors[static_cast<size_t>(Q * (Errors.size() - 1))]); };
+
+      std::printf("quartic %s: %.1f Mquartics/s, %d of %d wrong roots counts\n", Name, Num / SolveTime * 1e-6, Wrong, Num);
+      std::printf("quartic %s: relative error median %.2e, 99%% %.2e, 99.99%% %.2e, max %.2e\n",
+        Name, Quantile(0.5), Quantile(0.99), Quantile(0.9999), Quantile(1));
+      return Wrong == 0 && Quantile(0.9999) < MaxError;
+    } /* End of 'QuarticType' function */
+
+  /* Quartic solver accuracy check function.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (bool) true if double and float checks passed.
+   */
+  inline bool Quartic( void )
+  {
+    const bool IsDbl = QuarticType<DBL>("double", 1e-10);
+
+    return QuarticType<FLT>("float", static_cast<FLT>(1e-3)) && IsDbl;
+  } /* End of 'Quartic' function */
+
+  /* Sparse conjugate gradients thread scaling benchmark function.
+   * 3D Poisson problems (unit right hand side) are solved with
+   * 1, 2, 4, ... threads.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (bool) true if all solves converged.
+   */
+  inline bool Sparse( void )
+  {
+    using sparse = mth::sparse<DBL>;
+    const DBL Tol = 1e-8;
+    bool IsOk = true;
+
+    for (const int Size : {24, 64})
+    {
+      const sparse A = sparse::Poisson3D(mth::vec3<int>(Size));
+      const std::vector<DBL> B(A.Rows, 1);
+
+      for (const sparse::precond P : {sparse::precond::JACOBI, sparse::precond::IC0})
+      {
+        DBL Time1 = 0;
+
+        for (int Threads = 1; ; Threads *= 2)
+        {
+          const int T = std::min(Threads, mth::parallel::ThreadsCount());
+          std::vector<DBL> X(A.Rows, 0);
+          DBL Res;
+
+          const DBL T0 = Time();
+          const int Iter = A.CG(B.data(), X.data(), P, Tol, 1000, &Res, T);
+          const DBL SolveTime = Time() - T0;
+
+          if (T == 1)
+            Time1 = SolveTime;
+          IsOk &= Res <= Tol;
+          std::printf("sparse %d^3 %s: %d threads, %d iterations, %.1f ms (%.1f us/iteration), speedup %.2f, residual %.1e\n",
+            Size, P == sparse::precond::IC0 ? "IC0" : "Jacobi", T, Iter, SolveTime * 1000, SolveTime * 1e6 / Iter, Time1 / SolveTime, Res);
+          if (T == mth::parallel::ThreadsCount())
+            break;
+        }
+      }
+    }
+    return IsOk;
+  } /* End of 'Sparse' function */
+
+  /* Dual numbers gradient error (against central differences) function.
+   * ARGUMENTS:
+   *   - function of 3 variables (called with DBL and dual arguments):
+   *       const Func &F;
+   *   - point to evaluate gradient at:
+   *       const DBL X, Y, Z;
+   * RETURNS:
+   *   (DBL) maximal relative gradient component error.
+   */
+  template<typename Func>
+    inline DBL DualError( const Func &F, const DBL X, const DBL Y, const DBL Z )
+    {
+      using dual = mth::dual<DBL, 3>;
+      const dual R = F(dual::Variable(X, 0), dual::Variable(Y, 1), dual::Variable(Z, 2));
+      const DBL H = 1e-5;
+      DBL Error = 0;
+
+      for (int i = 0; i < 3; i++)
+      {
+        DBL P[3] = {X, Y, Z}, M[3] = {X, Y, Z};
+
+        P[i] += H;
+        M[i] -= H;
+
+        const DBL Fd = (F(P[0], P[1], P[2]) - F(M[0], M[1], M[2])) / (2 * H);
+
+        Error = std::max(Error, std::abs(R[i] - Fd) / std::max(1.0, std::abs(Fd)));
+      }
+      return Error;
+    } /* End of 'DualError' function */
+
+  /* Dual numbers gradients check function.
+   * Gradients of matrix inverse, ray-sphere distance and vector
+   * interpolation through mth classes are compared with central differences.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (bool) true if gradients agree.
+   */
+  inline bool Dual( void )
+  {
+    const auto Inverse =
+      []( const auto X, const auto Y, const auto Z )
+      {
+        using T = std::remove_const_t<decltype(X)>;
+        const mth::matr<T> M(
+          2 + X, Y, 0, 0,
+          Z, 3, X * Y, 0,
+          0, 1, 4 + Z, 0,
+          X, Y, Z, 1);
+        const mth::matr<T> R = M.Inverse();
+
+        return R[0][0] + R[1][2] * R[3][1] + !M;
+      };
+    const auto Sphere =
+      []( const auto X, const auto Y, const auto Z )
+      {
+        using T = std::remove_const_t<decltype(X)>;
+
+        return mth::ray<T>(mth::vec3<T>(0, 0, -5), mth::vec3<T>(0, T(0.1), 1)).intersect(mth::vec3<T>(X, Y, Z), T(1));
+      };
+    const auto Lerp =
+      []( const auto X, const auto Y, const auto Z )
+      {
+        using T = std::remove_const_t<decltype(X)>;
+        const mth::vec3<T> V = mth::vec3<T>(X, Y, Z).Lerp(mth::vec3<T>(Z, X, Y) * T(2), X * Y);
+
+        return V.Length() + V.Floor().X + V.Ceil().Y;
+      };
+    const DBL
+      InverseError = DualError(Inverse, 0.3, 0.2, 0.1),
+      SphereError = DualError(Sphere, 0.3, 0.2, 0.1),
+      LerpError = DualError(Lerp, 0.3, 0.2, 0.1);
+
+    std::printf("dual: gradient relative errors: matr inverse %.1e, ray sphere %.1e, vec lerp %.1e\n",
+      InverseError, SphereError, LerpError);
+    return InverseError < 1e-6 && SphereError < 1e-6 && LerpError < 1e-6;
+  } /* End of 'Dual' function */
+
+  /* Noise cache misses benchmark for one value type function.
+   * Table noise (TAB_SIZE^2 values) and hash noise (512 byte permutation)
+   * are sampled at random points (worst case for table) and along grid rows.
+   * ARGUMENTS:
+   *   - value type name:
+   *       const char *Name;
+   * RETURNS: None.
+   */
+  template<typename Type>
+    inline void NoiseType( const char *Name )
+    {
+      const int Num = 1 << 20, Octaves = 6;
+      const auto Tab = std::make_unique<mth::noise<Type>>();
+      const mth::hash_noise<Type> Hash;
+      const cache_counter Counter;
+      mth::random::pcg Rnd(48);
+      std::vector<DBL> Random(2 * Num), Grid(2 * Num);
+
+      for (int i = 0; i < Num; i++)
+      {
+        Random[2 * i] = Rnd.Unit<DBL>() * 256;
+        Random[2 * i + 1] = Rnd.Unit<DBL>() * 256;
+        Grid[2 * i] = (i % 1024) * 0.25;
+        Grid[2 * i + 1] = (i / 1024) * 0.25;
+      }
+      std::printf("noise %s: table noise %zu bytes, hash noise %zu bytes%s\n", Name, sizeof(mth::noise<Type>), sizeof(Hash),
+        Counter.IsValid() ? "" : " (cache miss counters are not available)");
+
+      const auto Run =
+        [&]( const char *Case, const std::vector<DBL> &P, const auto &Sample )
+        {
+          volatile DBL Sink = 0;
+          long long L1, LL;
+          DBL S = 0;
+
+          Sample(P[0], P[1]); // Warm up tables and code
+          const DBL T0 = Time();
+          Counter.Count(
+            [&]( void )
+            {
+              for (int i = 0; i < Num; i++)
+                S += Sample(P[2 * i], P[2 * i + 1]);
+            }, L1, LL);
+          const DBL T = Time() - T0;
+
+          Sink = Sink + S;
+          if (L1 >= 0 && LL >= 0)
+            std::printf("noise %s: %-26s %6.1f ns/sample, %6.3f L1 misses/sample, %6.3f LLC misses/sample\n",
+              Name, Case, T * 1e9 / Num, static_cast<DBL>(L1) / Num, static_cast<DBL>(LL) / Num);
+          else
+            std::printf("noise %s: %-26s %6.1f ns/sample\n", Name, Case, T * 1e9 / Num);
+        };
+      const auto TabNoise = [&]( const DBL X, const DBL Y ) { return static_cast<DBL>(Tab->Noise2D(X, Y)); };
+      const auto HashNoise = [&]( const DBL X, const DBL Y ) { return static_cast<DBL>(Hash.Noise2D(static_cast<Type>(X), static_cast<Type>(Y))); };
+      const auto TabTurb = [&]( const DBL X, const DBL Y ) { return static_cast<DBL>(Tab->NoiseTurb2D(X, Y, Octaves)); };
+      const auto HashTurb = [&]( const DBL X, const DBL Y ) { return static_cast<DBL>(Hash.NoiseTurb2D(static_cast<Type>(X), static_cast<Type>(Y), Octaves)); };
+
+      Run("table Noise2D random", Random, TabNoise);
+      Run("hash Noise2D random", Random, HashNoise);
+      Run("table Noise2D grid", Grid, TabNoise);
+      Run("hash Noise2D grid", Grid, HashNoise);
+      Run("table NoiseTurb2D random", Random, TabTurb);
+      Run("hash NoiseTurb2D random", Random, HashTurb);
+    } /* End of 'NoiseType' function */
+
+  /* Noise cache misses benchmark function.
+   * ARGUMENTS: None.
+   * RETURNS:
+   *   (bool) true if compile time table is same as run time one.
+   */
+  inline bool Noise( void )
+  {
+    const auto Tab = std::make_unique<mth::noise<FLT>>();
+    const bool IsSame = std::memcmp(Tab->TabNoise, ConstNoise.TabNoise, sizeof(Tab->TabNoise)) == 0;
+
+    NoiseType<DBL>("double");
+    NoiseType<FLT>("float");
+    std::printf("noise float: compile time table %s run time one\n", IsSame ? "matches" : "differs from");
+    return IsSame;
+  } /* End of 'Noise' function */
+} /* end of 'bench' namespace */
+
+/* Benchmark section representation type */
+struct section
+{
+  const char *Name;    // Section name
+  bool (*Run)( void ); // Section function (returns false on failed check)
+}; /* End of 'section' structure */
+
+/* The main program function.
+ * ARGUMENTS:
+ *   - command line arguments:
+ *       const int Argc;
+ *       const char *Argv[];
+ * RETURNS:
+ *   (int) 0 if all checks passed, 1 otherwise.
+ */
+int main( const int Argc, const char *Argv[] )
+{
+  const section Sections[] =
+  {
+    {"bvh", bench::Bvh},
+    {"stream", bench::Stream},
+    {"refit", bench::Refit},
+    {"quartic", bench::Quartic},
+    {"sparse", bench::Sparse},
+    {"dual", bench::Dual},
+    {"noise", bench::Noise},
+  };
+  bool IsOk = true;
+
+  for (const section &S : Sections)
+  {
+    bool IsRun = Argc < 2;
+
+    for (int i = 1; i < Argc; i++)
+      IsRun |= std::strcmp(Argv[i], S.Name) == 0;
+    if (IsRun && !S.Run())
+    {
+      std::printf("%s: FAILED\n", S.Name);
+      IsOk = false;
+    }
+  }
+  return IsOk ? 0 : 1;
+} /* End of 'main' function */
+
+/* END OF 'bench.cpp' FILE */
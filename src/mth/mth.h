@@ -1,7 +1,7 @@
 /***************************************************************
  * FILE NAME   : mth.h
  * PURPOSE     : Math support module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_h_
@@ -11,8 +11,22 @@
 #include "mth_vec3.h"
 #include "mth_vec4.h"
 #include "mth_tensor.h"
+#include "mth_sym_tensor.h"
+#include "mth_dual.h"
+#include "mth_simd.h"
+#include "mth_parallel.h"
+#include "mth_box.h"
 #include "mth_solver.h"
+#include "mth_poly.h"
+#include "mth_matn.h"
+#include "mth_sparse.h"
 #include "mth_ray.h"
+#include "mth_ray_packet.h"
+#include "mth_tri_block.h"
+#include "mth_ray_stream.h"
+#include "mth_shape.h"
+#include "mth_bvh.h"
+#include "mth_wbvh.h"
 #include "mth_rand.h"
 #include "mth_quat.h"
 #include "mth_noise.h"
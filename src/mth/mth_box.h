@@ -0,0 +1,265 @@
+/***************************************************************
+ * FILE NAME   : mth_box.h
+ * PURPOSE     : Axis aligned box class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_box_h_
+#define __mth_box_h_
+
+#include <limits>
+
+#include "mth_def.h"
+#include "mth_simd.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+
+  /* Axis aligned box class */
+  template<typename Type>
+    class box
+    {
+      static_assert(number<Type>, "Number type is needed in box");
+
+    public:
+      vec3<Type>
+        Min, // Box minimal corner
+        Max; // Box maximal corner
+
+      /* Class default constructor */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr box( void ) = default;
+
+      /* Class constructor (point box).
+       * ARGUMENTS:
+       *   - box point:
+       *       const vec3<Type> &P;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr box( const vec3<Type> &P ) noexcept : Min(P), Max(P)
+      {
+      } /* End of 'box' function */
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - box minimal and maximal corners:
+       *       const vec3<Type> &Min1, &Max1;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr box( const vec3<Type> &Min1, const vec3<Type> &Max1 ) noexcept : Min(Min1), Max(Max1)
+      {
+      } /* End of 'box' function */
+
+      /* Obtain empty box (neutral for union) function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (box) empty box.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static box Empty( void ) noexcept
+      {
+        return box(vec3<Type>(std::numeric_limits<Type>::max()), vec3<Type>(std::numeric_limits<Type>::lowest()));
+      } /* End of 'Empty' function */
+
+      /* Obtain triangle bounding box function.
+       * ARGUMENTS:
+       *   - triangle vertices:
+       *       const vec3<Type> &V0, &V1, &V2;
+       * RETURNS:
+       *   (box) result box.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static box Triangle( const vec3<Type> &V0, const vec3<Type> &V1, const vec3<Type> &V2 ) noexcept
+      {
+        return box(V0.Min(V1).Min(V2), V0.Max(V1).Max(V2));
+      } /* End of 'Triangle' function */
+
+      /* Obtain sphere bounding box function.
+       * ARGUMENTS:
+       *   - center of the sphere:
+       *       const vec3<Type> &Center;
+       *   - radius of the sphere:
+       *       const Type Radius;
+       * RETURNS:
+       *   (box) result box.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static box Sphere( const vec3<Type> &Center, const Type Radius ) noexcept
+      {
+        return box(Center - vec3<Type>(Radius), Center + vec3<Type>(Radius));
+      } /* End of 'Sphere' function */
+
+      /* Get boxes union function.
+       * ARGUMENTS:
+       *   - box to unite with:
+       *       const box &B;
+       * RETURNS:
+       *   (box) result box.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr box operator|( const box &B ) const noexcept
+      {
+        return box(Min.Min(B.Min), Max.Max(B.Max));
+      } /* End of 'operator|' function */
+
+      /* Unite box with current function.
+       * ARGUMENTS:
+       *   - box to unite with:
+       *       const box &B;
+       * RETURNS:
+       *   (box &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr box & operator|=( const box &B ) noexcept
+      {
+        Min = Min.Min(B.Min);
+        Max = Max.Max(B.Max);
+        return *this;
+      } /* End of 'operator|=' function */
+
+      /* Unite point with current box function.
+       * ARGUMENTS:
+       *   - point to add:
+       *       const vec3<Type> &P;
+       * RETURNS:
+       *   (box &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr box & operator|=( const vec3<Type> &P ) noexcept
+      {
+        Min = Min.Min(P);
+        Max = Max.Max(P);
+        return *this;
+      } /* End of 'operator|=' function */
+
+      /* Get box center function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (vec3<Type>) box center.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr vec3<Type> Center( void ) const noexcept
+      {
+        return (Min + Max) * static_cast<Type>(0.5);
+      } /* End of 'Center' function */
+
+      /* Get box size function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (vec3<Type>) box size.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr vec3<Type> Size( void ) const noexcept
+      {
+        return Max - Min;
+      } /* End of 'Size' function */
+
+      /* Get box surface area function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (Type) surface area (0 for empty box).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Area( void ) const noexcept
+      {
+        if (IsEmpty())
+          return 0;
+
+        const vec3<Type> S = Max - Min;
+        return 2 * (S.X * S.Y + S.Y * S.Z + S.Z * S.X);
+      } /* End of 'Area' function */
+
+      /* Check if box is empty function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (bool) true if box is empty.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr bool IsEmpty( void ) const noexcept
+      {
+        return Min.X > Max.X || Min.Y > Max.Y || Min.Z > Max.Z;
+      } /* End of 'IsEmpty' function */
+
+      /* Get box largest axis function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (int) axis number (0 - 'x', 1 - 'y', 2 - 'z').
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr int MaxAxis( void ) const noexcept
+      {
+        const vec3<Type> S = Max - Min;
+
+        return S.X > S.Y ? (S.X > S.Z ? 0 : 2) : (S.Y > S.Z ? 1 : 2);
+      } /* End of 'MaxAxis' function */
+
+      /* Ray interval inside box (shape lanes kernel, see 'mth_shape.h') function.
+       * ARGUMENTS:
+       *   - rays origins, normalized directions and inverse directions components:
+       *       const Lane *Org, *Dir, *InvDir;
+       *   - interval inside box:
+       *       Lane &T0, &T1;
+       *   - interval valid mask:
+       *       Mask &Valid;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename Mask>
+        constexpr void Interval( const Lane *Org, const Lane *Dir, const Lane *InvDir, Lane &T0, Lane &T1, Mask &Valid ) const noexcept
+        {
+          T0 = Lane(-std::numeric_limits<Type>::infinity());
+          T1 = Lane(std::numeric_limits<Type>::infinity());
+          for (int i = 0; i < 3; i++)
+          {
+            const auto Neg = InvDir[i] < Lane(0);
+            const Lane
+              tn = (Select(Neg, Lane(Max[i]), Lane(Min[i])) - Org[i]) * InvDir[i],
+              tf = (Select(Neg, Lane(Min[i]), Lane(Max[i])) - Org[i]) * InvDir[i];
+
+            /* Comparisons with NaN are false, so interval value is kept */
+            T0 = Select(tn > T0, tn, T0);
+            T1 = Select(tf < T1, tf, T1);
+          }
+          Valid = T0 <= T1;
+        } /* End of 'Interval' function */
+
+    }; /* End of 'box' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_box_h_ */
+
+/* END OF 'mth_box.h' FILE */
@@ -0,0 +1,1117 @@
+/***************************************************************
+ * FILE NAME   : mth_bvh.h
+ * PURPOSE     : Bounding volume hierarchy class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_bvh_h_
+#define __mth_bvh_h_
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "mth_def.h"
+#include "mth_simd.h"
+#include "mth_box.h"
+#include "mth_parallel.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class ray;
+  template<typename Type, int N>
+    class ray_packet;
+
+  /* Bounding volume hierarchy class.
+   * Binary tree built by binned surface area heuristic (SAH) over primitives
+   * bounding boxes, nodes stored in depth-first order (left child follows parent).
+   * Primitives are not stored: traversal calls user intersection function
+   * for leaves primitives indices.
+   */
+  template<typename Type>
+    class bvh
+    {
+      static_assert(number<Type>, "Number type is needed in bvh");
+
+    public:
+      static const int BINS = 16;             // Number of SAH bins per axis
+      static const int MAX_DEPTH = 64;        // Maximal tree depth (traversal stack size)
+      static const int PARALLEL_MIN = 4096;   // Minimal primitives count to build subtree in separate thread
+      static const int SPLIT_MIN = 16384;     // Minimal primitives count per thread in node bounds and bins evaluation
+      static const int REFIT_DEPTH = 6;       // Depth of refit units (subtrees) roots
+      static const int STREAM_CHUNK = 4096;   // Number of rays traversed together in stream mode
+
+      /* Tree node representation type (32 bytes for FLT) */
+      struct node
+      {
+        vec3<Type> Min; /* Node box minimal corner */
+        UINT Offset;    /* Leaf: first primitive in 'Ind' array, inner node: right child index */
+        vec3<Type> Max; /* Node box maximal corner */
+        UINT Count;     /* Leaf: primitives count, inner node: 0 */
+
+        /* Check if node is leaf function.
+         * ARGUMENTS: None.
+         * RETURNS:
+         *   (bool) true if node is leaf.
+         */
+        constexpr bool IsLeaf( void ) const noexcept
+        {
+          return Count != 0;
+        } /* End of 'IsLeaf' function */
+      }; /* End of 'node' structure */
+
+      static_assert(!std::is_same_v<Type, FLT> || sizeof(node) == 32, "Compact 32 bytes node is needed in bvh");
+
+      /* Traversal result representation type */
+      struct hit
+      {
+        Type T;   /* Distance to intersection (must be set to maximal distance before search) */
+        int Prim; /* Hit primitive index */
+      }; /* End of 'hit' structure */
+
+      /* Refit unit (subtree at depth REFIT_DEPTH or shallower leaf) representation type */
+      struct subtree
+      {
+        UINT Node;        /* Subtree root node index */
+        UINT Size;        /* Number of nodes reserved for subtree (contiguous from root) */
+        int First, Count; /* Subtree primitives range in 'Ind' array */
+        Type Cost;        /* Subtree SAH cost after last (re)build */
+      }; /* End of 'subtree' structure */
+
+      std::vector<node> Nodes;        // Tree nodes in depth-first order (root is first)
+      std::vector<int> Ind;           // Primitives indices in leaves order
+      std::vector<subtree> Subtrees;  // Refit units in depth-first order
+      int MaxLeafSize = 4;            // Maximal primitives count in leaf
+      Type TreeCost = 0;              // Tree SAH cost after last build
+
+    private:
+      /* SAH bin representation type */
+      struct bin
+      {
+        box<Type> B; /* Primitives boxes union */
+        int Count;   /* Number of primitives in bin */
+      }; /* End of 'bin' structure */
+
+      /* Split plane representation type */
+      struct split
+      {
+        int Axis;      /* Split axis (-1 if no split found) */
+        int Bin;       /* Last bin of left part */
+        Type Cost;     /* SAH cost of split (unnormalized) */
+        Type Origin;   /* Centroids bounds minimum on split axis */
+        Type Scale;    /* Centroid to bin index scale on split axis */
+      }; /* End of 'split' structure */
+
+      /* Get centroid bin index function.
+       * ARGUMENTS:
+       *   - centroid coordinate:
+       *       const Type C;
+       *   - bins origin and scale:
+       *       const Type Origin, Scale;
+       * RETURNS:
+       *   (int) bin index.
+       */
+      constexpr static int BinIndex( const Type C, const Type Origin, const Type Scale ) noexcept
+      {
+        const int B = static_cast<int>((C - Origin) * Scale);
+
+        return B < 0 ? 0 : B >= BINS ? BINS - 1 : B;
+      } /* End of 'BinIndex' function */
+
+      /* Get box centroid coordinate function.
+       * ARGUMENTS:
+       *   - box:
+       *       const box<Type> &B;
+       *   - axis number:
+       *       const int Axis;
+       * RETURNS:
+       *   (Type) centroid coordinate.
+       */
+      constexpr static Type Centroid( const box<Type> &B, const int Axis ) noexcept
+      {
+        return (B.Min[Axis] + B.Max[Axis]) * static_cast<Type>(0.5);
+      } /* End of 'Centroid' function */
+
+      /* Get number of threads for node bounds and bins evaluation function.
+       * Nodes built inside subtree tasks are processed by their own thread
+       * only (subtree tasks already occupy hardware threads).
+       * ARGUMENTS:
+       *   - number of node primitives:
+       *       const int Count;
+       *   - node is built inside subtree task flag:
+       *       const bool IsTask;
+       * RETURNS:
+       *   (int) number of chunks (1 for serial evaluation).
+       */
+      static int SplitChunks( const int Count, const bool IsTask ) noexcept
+      {
+        if (IsTask)
+          return 1;
+
+        const int Chunks = Count / SPLIT_MIN;
+
+        return Chunks < 1 ? 1 : Chunks > parallel::ThreadsCount() ? parallel::ThreadsCount() : Chunks;
+      } /* End of 'SplitChunks' function */
+
+      /* Evaluate primitives range bounds function.
+       * ARGUMENTS:
+       *   - primitives boxes:
+       *       const box<Type> *Boxes;
+       *   - range in 'Ind' array:
+       *       const int First, Count;
+       *   - range boxes and centroids bounds:
+       *       box<Type> &B, &CB;
+       *   - node is built inside subtree task flag:
+       *       const bool IsTask;
+       * RETURNS: None.
+       */
+      void Bounds( const box<Type> *Boxes, const int First, const int Count, box<Type> &B, box<Type> &CB, const bool IsTask ) const
+      {
+        const auto Eval =
+          [&]( const int Begin, const int End, box<Type> &Bc, box<Type> &CBc )
+          {
+            Bc = CBc = box<Type>::Empty();
+            for (int i = Begin; i < End; i++)
+            {
+              Bc |= Boxes[Ind[i]];
+              CBc |= Boxes[Ind[i]].Center();
+            }
+          };
+        const int MaxChunks = SplitChunks(Count, IsTask);
+
+        if (MaxChunks == 1)
+        {
+          Eval(First, First + Count, B, CB);
+          return;
+        }
+
+        std::vector<box<Type>> Part(2 * MaxChunks);
+        const int Chunks = parallel::For(First, First + Count,
+          [&]( const int Begin, const int End, const int Chunk )
+          {
+            Eval(Begin, End, Part[Chunk * 2], Part[Chunk * 2 + 1]);
+          }, SPLIT_MIN, MaxChunks);
+
+        B = CB = box<Type>::Empty();
+        for (int i = 0; i < Chunks; i++)
+        {
+          B |= Part[i * 2];
+          CB |= Part[i * 2 + 1];
+        }
+      } /* End of 'Bounds' function */
+
+      /* Find best SAH split function.
+       * ARGUMENTS:
+       *   - primitives boxes:
+       *       const box<Type> *Boxes;
+       *   - range in 'Ind' array:
+       *       const int First, Count;
+       *   - range centroids bounds:
+       *       const box<Type> &CB;
+       *   - node is built inside subtree task flag:
+       *       const bool IsTask;
+       * RETURNS:
+       *   (split) best split (axis -1 if centroids coincide).
+       */
+      split FindSplit( const box<Type> *Boxes, const int First, const int Count, const box<Type> &CB, const bool IsTask ) const
+      {
+        split Best {-1, 0, std::numeric_limits<Type>::max(), 0, 0};
+        Type Origin[3], Scale[3];
+
+        for (int a = 0; a < 3; a++)
+        {
+          const Type Ext = CB.Max[a] - CB.Min[a];
+
+          Origin[a] = CB.Min[a];
+          Scale[a] = Ext > 0 ? BINS / Ext : 0;
+        }
+
+        /* Fill bins for all axes (small nodes in stack bins, large ones per chunk, then merge) */
+        const auto Fill =
+          [&]( const int Begin, const int End, bin *Bins )
+          {
+            for (int i = 0; i < 3 * BINS; i++)
+              Bins[i] = bin {box<Type>::Empty(), 0};
+            for (int i = Begin; i < End; i++)
+            {
+              const int P = Ind[i];
+
+              for (int a = 0; a < 3; a++)
+              {
+                bin &Bn = Bins[a * BINS + BinIndex(Centroid(Boxes[P], a), Origin[a], Scale[a])];
+
+                Bn.B |= Boxes[P];
+                Bn.Count++;
+              }
+            }
+          };
+        const int MaxChunks = SplitChunks(Count, IsTask);
+        bin Local[3 * BINS];
+        std::vector<bin> Part;
+        bin *Merged = Local;
+
+        if (MaxChunks == 1)
+          Fill(First, First + Count, Local);
+        else
+        {
+          Part.resize(MaxChunks * 3 * BINS);
+          Merged = Part.data();
+
+          const int Chunks = parallel::For(First, First + Count,
+            [&]( const int Begin, const int End, const int Chunk )
+            {
+              Fill(Begin, End, &Part[Chunk * 3 * BINS]);
+            }, SPLIT_MIN, MaxChunks);
+
+          for (int c = 1; c < Chunks; c++)
+            for (int i = 0; i < 3 * BINS; i++)
+            {
+              Part[i].B |= Part[c * 3 * BINS + i].B;
+              Part[i].Count += Part[c * 3 * BINS + i].Count;
+            }
+        }
+
+        /* Sweep bins planes */
+        for (int a = 0; a < 3; a++)
+        {
+          if (Scale[a] == 0)
+            continue;
+
+          const bin *Bins = &Merged[a * BINS];
+          Type RightArea[BINS];
+          int RightCount[BINS];
+          box<Type> Acc = box<Type>::Empty();
+          int Cnt = 0;
+
+          for (int i = BINS - 1; i > 0; i--)
+          {
+            Acc |= Bins[i].B;
+            Cnt += Bins[i].Count;
+            RightArea[i] = Acc.Area();
+            RightCount[i] = Cnt;
+          }
+          Acc = box<Type>::Empty();
+          Cnt = 0;
+          for (int i = 0; i < BINS - 1; i++)
+          {
+            Acc |= Bins[i].B;
+            Cnt += Bins[i].Count;
+            if (Cnt == 0 || RightCount[i + 1] == 0)
+              continue;
+
+            const Type Cost = Acc.Area() * Cnt + RightArea[i + 1] * RightCount[i + 1];
+
+            if (Cost < Best.Cost)
+              Best = split {a, i, Cost, Origin[a], Scale[a]};
+          }
+        }
+        return Best;
+      } /* End of 'FindSplit' function */
+
+    protected:
+      /* Build subtree function.
+       * Subtree over Count primitives occupies at most 2 * Count - 1 nodes
+       * starting from NodeInd, so subtrees are built in disjoint node ranges
+       * (in parallel) and compacted afterwards.
+       * ARGUMENTS:
+       *   - temporary nodes array (at least NodeInd + 2 * Count - 1 nodes):
+       *       std::vector<node> &Tmp;
+       *   - primitives boxes:
+       *       const box<Type> *Boxes;
+       *   - subtree root node index:
+       *       const UINT NodeInd;
+       *   - primitives range in 'Ind' array:
+       *       const int First, Count;
+       *   - subtree root depth:
+       *       const int Depth;
+       *   - number of levels to spawn threads on:
+       *       const int SpawnDepth;
+       *   - node is built inside subtree task flag (no nested parallel loops):
+       *       const bool IsTask;
+       * RETURNS: None.
+       */
+      void BuildNode( std::vector<node> &Tmp, const box<Type> *Boxes,
+                      const UINT NodeInd, const int First, const int Count, const int Depth, const int SpawnDepth, const bool IsTask )
+      {
+        box<Type> B, CB;
+
+        Bounds(Boxes, First, Count, B, CB, IsTask);
+
+        node &Nd = Tmp[NodeInd];
+
+        Nd.Min = B.Min;
+        Nd.Max = B.Max;
+        Nd.Offset = First;
+        Nd.Count = Count;
+        if (Count <= 1 || Depth >= MAX_DEPTH - 1)
+          return;
+
+        const split S = FindSplit(Boxes, First, Count, CB, IsTask);
+        int Mid = First + Count / 2;
+
+        if (S.Axis < 0)
+        {
+          /* All centroids coincide - split by count if leaf is too big */
+          if (Count <= MaxLeafSize)
+            return;
+        }
+        else
+        {
+          if (Count <= MaxLeafSize && Count * B.Area() <= B.Area() + S.Cost)
+            return;
+          Mid = static_cast<int>(std::partition(Ind.begin() + First, Ind.begin() + First + Count,
+            [&]( const int P )
+            {
+              return BinIndex(Centroid(Boxes[P], S.Axis), S.Origin, S.Scale) <= S.Bin;
+            }) - Ind.begin());
+          if (Mid == First || Mid == First + Count)
+            Mid = First + Count / 2;
+        }
+
+        const int CountL = Mid - First, CountR = Count - CountL;
+        const bool IsSpawn = SpawnDepth > 0 && Count >= PARALLEL_MIN && parallel::ThreadsCount() > 1;
+
+        Nd.Offset = NodeInd + 2 * CountL;
+        Nd.Count = 0;
+        parallel::Invoke(
+          [&, CountL, IsSpawn]( void )
+          {
+            BuildNode(Tmp, Boxes, NodeInd + 1, First, CountL, Depth + 1, SpawnDepth - 1, IsTask || IsSpawn);
+          },
+          [&, CountL, CountR, IsSpawn]( void )
+          {
+            BuildNode(Tmp, Boxes, NodeInd + 2 * CountL, Mid, CountR, Depth + 1, SpawnDepth - 1, IsTask || IsSpawn);
+          }, IsSpawn);
+      } /* End of 'BuildNode' function */
+
+      /* Copy subtree in compact depth-first order function.
+       * ARGUMENTS:
+       *   - source nodes array:
+       *       const std::vector<node> &Src;
+       *   - source subtree root index:
+       *       const UINT SrcInd;
+       *   - destination nodes array:
+       *       std::vector<node> &Dst;
+       * RETURNS:
+       *   (UINT) subtree root index in destination array.
+       */
+      static UINT Compact( const std::vector<node> &Src, const UINT SrcInd, std::vector<node> &Dst )
+      {
+        const UINT DstInd = static_cast<UINT>(Dst.size());
+
+        Dst.push_back(Src[SrcInd]);
+        if (!Src[SrcInd].IsLeaf())
+        {
+          Compact(Src, SrcInd + 1, Dst);
+          Dst[DstInd].Offset = Compact(Src, Src[SrcInd].Offset, Dst);
+        }
+        return DstInd;
+      } /* End of 'Compact' function */
+
+      /* Get number of spawn levels for parallel build function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (int) levels count.
+       */
+      static int SpawnLevels( void ) noexcept
+      {
+        int Levels = 1;
+
+        while ((1 << (Levels - 1)) < parallel::ThreadsCount())
+          Levels++;
+        return Levels;
+      } /* End of 'SpawnLevels' function */
+
+      /* Get node box area (1 for empty or flat box) function.
+       * ARGUMENTS:
+       *   - node index:
+       *       const UINT Node;
+       * RETURNS:
+       *   (Type) node box area.
+       */
+      Type RootArea( const UINT Node ) const noexcept
+      {
+        const Type A = box<Type>(Nodes[Node].Min, Nodes[Node].Max).Area();
+
+        return A > 0 ? A : 1;
+      } /* End of 'RootArea' function */
+
+      /* Collect refit units function.
+       * ARGUMENTS:
+       *   - subtree root node index:
+       *       const UINT Node;
+       *   - node depth:
+       *       const int Depth;
+       * RETURNS: None.
+       */
+      void CollectSubtrees( const UINT Node, const int Depth )
+      {
+        if (!Nodes[Node].IsLeaf() && Depth < REFIT_DEPTH)
+        {
+          CollectSubtrees(Node + 1, Depth + 1);
+          CollectSubtrees(Nodes[Node].Offset, Depth + 1);
+          return;
+        }
+
+        subtree S {Node, 0, std::numeric_limits<int>::max(), 0, Cost(Node)};
+        UINT Stack[MAX_DEPTH];
+        int Sp = 0;
+
+        Stack[Sp++] = Node;
+        while (Sp > 0)
+        {
+          const UINT Cur = Stack[--Sp];
+          const node &Nd = Nodes[Cur];
+
+          S.Size++;
+          if (Nd.IsLeaf())
+          {
+            S.First = std::min(S.First, static_cast<int>(Nd.Offset));
+            S.Count += Nd.Count;
+          }
+          else
+          {
+            Stack[Sp++] = Cur + 1;
+            Stack[Sp++] = Nd.Offset;
+          }
+        }
+        Subtrees.push_back(S);
+      } /* End of 'CollectSubtrees' function */
+
+      /* Refit subtree function.
+       * ARGUMENTS:
+       *   - primitives bounding boxes:
+       *       const box<Type> *Boxes;
+       *   - subtree root node index:
+       *       const UINT Node;
+       * RETURNS:
+       *   (Type) subtree SAH cost (not normalized).
+       */
+      Type RefitNode( const box<Type> *Boxes, const UINT Node )
+      {
+        node &Nd = Nodes[Node];
+
+        if (Nd.IsLeaf())
+        {
+          box<Type> B = box<Type>::Empty();
+
+          for (UINT i = 0; i < Nd.Count; i++)
+            B |= Boxes[Ind[Nd.Offset + i]];
+          Nd.Min = B.Min;
+          Nd.Max = B.Max;
+          return B.Area() * Nd.Count;
+        }
+
+        const Type Cost = RefitNode(Boxes, Node + 1) + RefitNode(Boxes, Nd.Offset);
+        const node &L = Nodes[Node + 1], &R = Nodes[Nd.Offset];
+
+        Nd.Min = L.Min.Min(R.Min);
+        Nd.Max = L.Max.Max(R.Max);
+        return Cost + box<Type>(Nd.Min, Nd.Max).Area();
+      } /* End of 'RefitNode' function */
+
+      /* Refit nodes above refit units function.
+       * ARGUMENTS:
+       *   - node index:
+       *       const UINT Node;
+       *   - node depth:
+       *       const int Depth;
+       *   - refit units SAH costs (not normalized):
+       *       const std::vector<Type> &UnitCost;
+       *   - current refit unit index:
+       *       int &K;
+       * RETURNS:
+       *   (Type) subtree SAH cost (not normalized).
+       */
+      Type RefitTop( const UINT Node, const int Depth, const std::vector<Type> &UnitCost, int &K )
+      {
+        node &Nd = Nodes[Node];
+
+        if (Nd.IsLeaf() || Depth >= REFIT_DEPTH)
+          return UnitCost[K++];
+
+        const Type Cost = RefitTop(Node + 1, Depth + 1, UnitCost, K) + RefitTop(Nd.Offset, Depth + 1, UnitCost, K);
+        const node &L = Nodes[Node + 1], &R = Nodes[Nd.Offset];
+
+        Nd.Min = L.Min.Min(R.Min);
+        Nd.Max = L.Max.Max(R.Max);
+        return Cost + box<Type>(Nd.Min, Nd.Max).Area();
+      } /* End of 'RefitTop' function */
+
+      /* Copy tree with rebuilt refit units in compact depth-first order function.
+       * ARGUMENTS:
+       *   - source node index:
+       *       const UINT Src;
+       *   - node depth:
+       *       const int Depth;
+       *   - destination nodes array:
+       *       std::vector<node> &Dst;
+       *   - rebuilt units nodes (empty for kept units):
+       *       const std::vector<std::vector<node>> &Subs;
+       *   - current refit unit index:
+       *       int &K;
+       * RETURNS:
+       *   (UINT) subtree root index in destination array.
+       */
+      UINT Relayout( const UINT Src, const int Depth, std::vector<node> &Dst, const std::vector<std::vector<node>> &Subs, int &K ) const
+      {
+        const node &Nd = Nodes[Src];
+
+        if (Nd.IsLeaf() || Depth >= REFIT_DEPTH)
+        {
+          const std::vector<node> &Sub = Subs[K++];
+
+          if (Sub.empty())
+            return Compact(Nodes, Src, Dst);
+
+          const UINT Base = static_cast<UINT>(Dst.size());
+
+          for (node N : Sub)
+          {
+            if (!N.IsLeaf())
+              N.Offset += Base;
+            Dst.push_back(N);
+          }
+          return Base;
+        }
+
+        const UINT DstInd = static_cast<UINT>(Dst.size());
+
+        Dst.push_back(Nd);
+        Relayout(Src + 1, Depth + 1, Dst, Subs, K);
+        Dst[DstInd].Offset = Relayout(Nd.Offset, Depth + 1, Dst, Subs, K);
+        return DstInd;
+      } /* End of 'Relayout' function */
+
+    public:
+      /* Class default constructor */
+      bvh( void ) = default;
+
+      /* Class constructor (builds tree).
+       * ARGUMENTS:
+       *   - primitives bounding boxes:
+       *       const box<Type> *Boxes;
+       *   - number of primitives:
+       *       const int Count;
+       *   - maximal primitives count in leaf:
+       *       const int MaxLeaf = 4;
+       */
+      bvh( const box<Type> *Boxes, const int Count, const int MaxLeaf = 4 )
+      {
+        Build(Boxes, Count, MaxLeaf);
+      } /* End of 'bvh' function */
+
+      /* Build tree function.
+       * ARGUMENTS:
+       *   - primitives bounding boxes:
+       *       const box<Type> *Boxes;
+       *   - number of primitives:
+       *       const int Count;
+       *   - maximal primitives count in leaf:
+       *       const int MaxLeaf = 4;
+       * RETURNS:
+       *   (bvh &) self reference.
+       */
+      bvh & Build( const box<Type> *Boxes, const int Count, const int MaxLeaf = 4 )
+      {
+        Nodes.clear();
+        Subtrees.clear();
+        Ind.resize(Count > 0 ? Count : 0);
+        MaxLeafSize = MaxLeaf > 0 ? MaxLeaf : 1;
+        if (Count <= 0)
+          return *this;
+
+        for (int i = 0; i < Count; i++)
+          Ind[i] = i;
+
+        std::vector<node> Tmp(2 * static_cast<size_t>(Count) - 1);
+
+        BuildNode(Tmp, Boxes, 0, 0, Count, 0, SpawnLevels(), false);
+        Nodes.reserve(Tmp.size());
+        Compact(Tmp, 0, Nodes);
+        Nodes.shrink_to_fit();
+        CollectSubtrees(0, 0);
+        TreeCost = Cost();
+        return *this;
+      } /* End of 'Build' function */
+
+      /* Refit tree to moved primitives function.
+       * Node boxes are updated bottom-up (refit units in parallel), tree
+       * topology is kept. Units which SAH cost grew more than 'Threshold'
+       * times since last (re)build are rebuilt from their own primitives,
+       * in place if new subtree fits unit nodes (otherwise nodes array is
+       * relaid out), so update cost follows moved geometry amount.
+       * Whole tree is rebuilt if its total cost grew more than 'Threshold' times.
+       * ARGUMENTS:
+       *   - primitives bounding boxes (same primitives as on build):
+       *       const box<Type> *Boxes;
+       *   - SAH cost growth threshold to rebuild subtree (0 for refit only):
+       *       const Type Threshold = 0;
+       * RETURNS:
+       *   (int) number of rebuilt subtrees.
+       */
+      int Refit( const box<Type> *Boxes, const Type Threshold = 0 )
+      {
+        if (Nodes.empty())
+          return 0;
+
+        const int Count = static_cast<int>(Subtrees.size());
+        std::vector<Type> UnitCost(Count);
+
+        parallel::For(0, Count,
+          [&]( const int Begin, const int End, const int )
+          {
+            for (int i = Begin; i < End; i++)
+            {
+              UnitCost[i] = RefitNode(Boxes, Subtrees[i].Node);
+            }
+          });
+
+        std::vector<int> Rebuild;
+
+        for (int i = 0; i < Count; i++)
+          if (Threshold > 0 && UnitCost[i] > Subtrees[i].Cost * RootArea(Subtrees[i].Node) * Threshold)
+          {
+            /* Rebuilt unit is expected to restore its cost (unit box is kept) */
+            UnitCost[i] = Subtrees[i].Cost * RootArea(Subtrees[i].Node);
+            Rebuild.push_back(i);
+          }
+
+        /* Top nodes topology is never changed by refit, so whole tree is rebuilt when it degrades */
+        int K = 0;
+        const Type TotalCost = RefitTop(0, 0, UnitCost, K) / RootArea(0);
+
+        if (Threshold > 0 && TotalCost > TreeCost * Threshold)
+        {
+          Build(Boxes, static_cast<int>(Ind.size()), MaxLeafSize);
+          return Count;
+        }
+
+        if (!Rebuild.empty())
+        {
+          /* Build degraded subtrees (primitives ranges are disjoint) */
+          std::vector<std::vector<node>> Subs(Count);
+
+          parallel::For(0, static_cast<int>(Rebuild.size()),
+            [&]( const int Begin, const int End, const int )
+            {
+              for (int i = Begin; i < End; i++)
+              {
+                const subtree &S = Subtrees[Rebuild[i]];
+                std::vector<node> Tmp(2 * static_cast<size_t>(S.Count) - 1);
+
+                BuildNode(Tmp, Boxes, 0, S.First, S.Count, REFIT_DEPTH, 0, true);
+                Compact(Tmp, 0, Subs[Rebuild[i]]);
+              }
+            });
+
+          /* Place subtrees in their nodes ranges if possible */
+          bool IsRelayout = false;
+
+          for (const int i : Rebuild)
+          {
+            subtree &S = Subtrees[i];
+
+            if (Subs[i].size() > S.Size)
+            {
+              IsRelayout = true;
+              continue;
+            }
+            for (size_t k = 0; k < Subs[i].size(); k++)
+            {
+              Nodes[S.Node + k] = Subs[i][k];
+              if (!Subs[i][k].IsLeaf())
+                Nodes[S.Node + k].Offset += S.Node;
+            }
+            Subs[i].clear();
+            S.Cost = Cost(S.Node);
+          }
+          if (IsRelayout)
+          {
+            std::vector<node> Dst;
+            int K = 0;
+
+            Dst.reserve(Nodes.size());
+            Relayout(0, 0, Dst, Subs, K);
+            Nodes = std::move(Dst);
+
+            /* Units keep their primitives ranges (in same order), so baselines
+             * of units which were not rebuilt are kept to track their drift */
+            std::vector<subtree> Old = std::move(Subtrees);
+            std::vector<bool> IsRebuilt(Count);
+
+            for (const int i : Rebuild)
+              IsRebuilt[i] = true;
+            Subtrees.clear();
+            CollectSubtrees(0, 0);
+            for (size_t i = 0, j = 0; i < Subtrees.size(); i++)
+            {
+              while (j < Old.size() && Old[j].First < Subtrees[i].First)
+                j++;
+              if (j < Old.size() && Old[j].First == Subtrees[i].First && Old[j].Count == Subtrees[i].Count && !IsRebuilt[j])
+                Subtrees[i].Cost = Old[j].Cost;
+            }
+          }
+        }
+        return static_cast<int>(Rebuild.size());
+      } /* End of 'Refit' function */
+
+      /* Evaluate tree SAH cost function.
+       * ARGUMENTS:
+       *   - subtree root node index:
+       *       const UINT Root = 0;
+       * RETURNS:
+       *   (Type) SAH cost (normalized by root area: expected number of visited nodes and primitives).
+       */
+      Type Cost( const UINT Root = 0 ) const noexcept
+      {
+        if (Nodes.empty())
+          return 0;
+
+        const Type RootArea = box<Type>(Nodes[Root].Min, Nodes[Root].Max).Area();
+        Type Cost = 0;
+        UINT Stack[MAX_DEPTH];
+        int Sp = 0;
+
+        Stack[Sp++] = Root;
+        while (Sp > 0)
+        {
+          const UINT Cur = Stack[--Sp];
+          const node &Nd = Nodes[Cur];
+          const Type A = box<Type>(Nd.Min, Nd.Max).Area();
+
+          if (Nd.IsLeaf())
+            Cost += A * Nd.Count;
+          else
+          {
+            Cost += A;
+            Stack[Sp++] = Cur + 1;
+            Stack[Sp++] = Nd.Offset;
+          }
+        }
+        return RootArea > 0 ? Cost / RootArea : Cost;
+      } /* End of 'Cost' function */
+
+      /* Find closest intersection function.
+       * Children are visited in order of box entry distances, farther subtrees
+       * are culled by closest found distance.
+       * ARGUMENTS:
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - intersection result (T must be set to maximal distance, updated on hit):
+       *       hit &Hit;
+       *   - primitive intersection function (called as F(PrimIndex, R), returns distance or -1):
+       *       const Func &F;
+       * RETURNS:
+       *   (bool) true if hit found.
+       */
+      template<typename Func>
+        bool Intersect( const ray<Type> &R, hit &Hit, const Func &F ) const
+        {
+          return Traverse<false>(R, Hit, F, 0);
+        } /* End of 'Intersect' function */
+
+      /* Find any intersection function (stops at first found hit).
+       * ARGUMENTS:
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - intersection result (T must be set to maximal distance, updated on hit):
+       *       hit &Hit;
+       *   - primitive intersection function (called as F(PrimIndex, R), returns distance or -1):
+       *       const Func &F;
+       * RETURNS:
+       *   (bool) true if hit found.
+       */
+      template<typename Func>
+        bool IntersectAny( const ray<Type> &R, hit &Hit, const Func &F ) const
+        {
+          return Traverse<true>(R, Hit, F, 0);
+        } /* End of 'IntersectAny' function */
+
+      /* Occlusion query function (stops at first hit in distances range).
+       * ARGUMENTS:
+       *   - ray to test:
+       *       const ray<Type> &R;
+       *   - distances range [TMin, TMax] (negative TMin is same as 0, so misses never occlude):
+       *       const Type TMin, TMax;
+       *   - primitive intersection function (called as F(PrimIndex, R), returns distance or -1):
+       *       const Func &F;
+       * RETURNS:
+       *   (bool) true if ray is occluded.
+       */
+      template<typename Func>
+        bool Occluded( const ray<Type> &R, const Type TMin, const Type TMax, const Func &F ) const
+        {
+          hit Hit {std::nextafter(TMax, std::numeric_limits<Type>::infinity()), -1};
+
+          return Traverse<true>(R, Hit, F, Max(TMin, Type(0)));
+        } /* End of 'Occluded' function */
+
+      /* Rays packet occlusion query function.
+       * Packet descends while any active not occluded lane hits node box,
+       * query stops as soon as all active lanes are occluded.
+       * ARGUMENTS:
+       *   - rays packet to test:
+       *       const ray_packet<Type, N> &R;
+       *   - lanes distances ranges [TMin, TMax] (negative TMin is same as 0, so misses never occlude):
+       *       const simd<Type, N> &TMin, &TMax;
+       *   - primitive packet intersection function (called as F(PrimIndex, R), returns simd<Type, N> distances or -1):
+       *       const Func &F;
+       *   - active lanes bits:
+       *       const UINT Active = ~0u;
+       * RETURNS:
+       *   (UINT) occluded lanes bits.
+       */
+      template<int N, typename Func>
+        UINT Occluded( const ray_packet<Type, N> &R, const simd<Type, N> &TMin, const simd<Type, N> &TMax, const Func &F, const UINT Active = ~0u ) const
+        {
+          const UINT All = Active & simd_mask<Type, N>(true).Bits();
+          const simd<Type, N> Lo = Max(TMin, simd<Type, N>(0));
+          UINT Occ = 0, Stack[MAX_DEPTH];
+          int Sp = 0;
+
+          if (Nodes.empty() || All == 0)
+            return 0;
+          Stack[Sp++] = 0;
+          while (Sp > 0)
+          {
+            const UINT Cur = Stack[--Sp];
+            const node &Nd = Nodes[Cur];
+            simd<Type, N> t0 = Lo, t1 = TMax;
+            UINT Bits = R.IntersectBox(Nd.Min, Nd.Max, t0, t1).Bits() & All & ~Occ;
+
+            if (Bits == 0)
+              continue;
+            if (!Nd.IsLeaf())
+            {
+              Stack[Sp++] = Nd.Offset;
+              Stack[Sp++] = Cur + 1;
+              continue;
+            }
+            for (UINT i = 0; i < Nd.Count && Bits != 0; i++)
+            {
+              const simd<Type, N> T = F(Ind[Nd.Offset + i], R);
+
+              Occ |= ((T >= Lo) & (T <= TMax)).Bits() & Bits;
+              Bits &= ~Occ;
+            }
+            if (Occ == All)
+              break;
+          }
+          return Occ;
+        } /* End of 'Occluded' function */
+
+      /* Find closest intersections for rays stream (breadth-first traversal) function.
+       * All rays reaching node are processed together: node box is tested for
+       * every active ray, leaf primitives are intersected with all active rays
+       * (primitive data stays in cache), children are visited in order voted by rays.
+       * Rays should be coherent (e.g. sorted by 'ray_stream::Sort').
+       * ARGUMENTS:
+       *   - rays array:
+       *       const ray<Type> *Rays;
+       *   - number of rays:
+       *       const int Count;
+       *   - rays intersection results (T must be set to maximal distances, updated on hit):
+       *       hit *Hits;
+       *   - primitive intersection function (called as F(PrimIndex, R), returns distance or -1):
+       *       const Func &F;
+       * RETURNS: None.
+       */
+      template<typename Func>
+        void IntersectStream( const ray<Type> *Rays, const int Count, hit *Hits, const Func &F ) const
+        {
+          if (Nodes.empty() || Count <= 0)
+            return;
+
+          std::vector<int> Active;
+
+          /* Rays are processed by chunks to keep active lists in cache */
+          Active.reserve(STREAM_CHUNK * 8);
+          for (int First = 0; First < Count; First += STREAM_CHUNK)
+          {
+            Active.clear();
+            for (int i = First; i < Count && i < First + STREAM_CHUNK; i++)
+              Active.push_back(i);
+            StreamNode(0, Rays, Hits, F, Active, 0);
+          }
+        } /* End of 'IntersectStream' function */
+
+    private:
+      /* Traverse node by rays stream function.
+       * ARGUMENTS:
+       *   - node index:
+       *       const UINT Node;
+       *   - rays array:
+       *       const ray<Type> *Rays;
+       *   - rays intersection results:
+       *       hit *Hits;
+       *   - primitive intersection function:
+       *       const Func &F;
+       *   - active rays indices stack (rays reaching node start from 'Begin'):
+       *       std::vector<int> &Active;
+       *   - node rays start in 'Active':
+       *       const size_t Begin;
+       * RETURNS: None.
+       */
+      template<typename Func>
+        void StreamNode( const UINT Node, const ray<Type> *Rays, hit *Hits, const Func &F, std::vector<int> &Active, const size_t Begin ) const
+        {
+          const node &Nd = Nodes[Node];
+          const size_t End = Active.size();
+
+          /* Rays hitting node box */
+          for (size_t k = Begin; k < End; k++)
+          {
+            const int i = Active[k];
+            Type t0 = 0, t1 = Hits[i].T;
+
+            if (Rays[i].IntersectBox(Nd.Min, Nd.Max, t0, t1))
+              Active.push_back(i);
+          }
+          if (Active.size() == End)
+            return;
+          if (Nd.IsLeaf())
+            for (UINT p = 0; p < Nd.Count; p++)
+            {
+              const int P = Ind[Nd.Offset + p];
+
+              for (size_t k = End; k < Active.size(); k++)
+              {
+                const int i = Active[k];
+                const Type T = F(P, Rays[i]);
+
+                if (T >= 0 && T < Hits[i].T)
+                {
+                  Hits[i].T = T;
+                  Hits[i].Prim = P;
+                }
+              }
+            }
+          else
+          {
+            /* Vote for children order by rays directions */
+            const node &L = Nodes[Node + 1], &R = Nodes[Nd.Offset];
+            const vec3<Type> D = (R.Min + R.Max) - (L.Min + L.Max);
+            Type Vote = 0;
+
+            for (size_t k = End; k < Active.size(); k++)
+              Vote += Rays[Active[k]].Dir & D;
+            if (Vote >= 0)
+            {
+              StreamNode(Node + 1, Rays, Hits, F, Active, End);
+              StreamNode(Nd.Offset, Rays, Hits, F, Active, End);
+            }
+            else
+            {
+              StreamNode(Nd.Offset, Rays, Hits, F, Active, End);
+              StreamNode(Node + 1, Rays, Hits, F, Active, End);
+            }
+          }
+          Active.resize(End);
+        } /* End of 'StreamNode' function */
+
+      /* Traverse tree function.
+       * ARGUMENTS:
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - intersection result:
+       *       hit &Hit;
+       *   - primitive intersection function:
+       *       const Func &F;
+       *   - minimal distance:
+       *       const Type TMin;
+       * RETURNS:
+       *   (bool) true if hit found.
+       */
+      template<bool IsAnyHit, typename Func>
+        bool Traverse( const ray<Type> &R, hit &Hit, const Func &F, const Type TMin ) const
+        {
+          if (Nodes.empty())
+            return false;
+
+          /* Stack entry: node index and its box entry distance */
+          struct entry
+          {
+            UINT Node;
+            Type T;
+          } Stack[MAX_DEPTH];
+          int Sp = 0;
+          bool IsFound = false;
+          Type t0 = TMin, t1 = Hit.T;
+
+          if (!R.IntersectBox(Nodes[0].Min, Nodes[0].Max, t0, t1))
+            return false;
+          Stack[Sp++] = entry {0, t0};
+          while (Sp > 0)
+          {
+            const entry E = Stack[--Sp];
+
+            if (E.T > Hit.T)
+              continue;
+
+            UINT Cur = E.Node;
+
+            while (true)
+            {
+              const node &Nd = Nodes[Cur];
+
+              if (Nd.IsLeaf())
+              {
+                for (UINT i = 0; i < Nd.Count; i++)
+                {
+                  const int P = Ind[Nd.Offset + i];
+                  const Type T = F(P, R);
+
+                  if (T >= TMin && T < Hit.T)
+                  {
+                    Hit.T = T;
+                    Hit.Prim = P;
+                    IsFound = true;
+                    if constexpr (IsAnyHit)
+                      return true;
+                  }
+                }
+                break;
+              }
+
+              UINT Near = Cur + 1, Far = Nd.Offset;
+              Type
+                tn0 = TMin, tn1 = Hit.T,
+                tf0 = TMin, tf1 = Hit.T;
+              const bool
+                IsNear = R.IntersectBox(Nodes[Near].Min, Nodes[Near].Max, tn0, tn1),
+                IsFar = R.IntersectBox(Nodes[Far].Min, Nodes[Far].Max, tf0, tf1);
+
+              if (IsNear && IsFar)
+              {
+                if (tf0 < tn0)
+                {
+                  std::swap(Near, Far);
+                  std::swap(tn0, tf0);
+                }
+                Stack[Sp++] = entry {Far, tf0};
+                Cur = Near;
+              }
+              else if (IsNear)
+                Cur = Near;
+              else if (IsFar)
+                Cur = Far;
+              else
+                break;
+            }
+          }
+          return IsFound;
+        } /* End of 'Traverse' function */
+
+    }; /* End of 'bvh' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_bvh_h_ */
+
+/* END OF 'mth_bvh.h' FILE */
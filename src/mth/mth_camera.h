@@ -1,13 +1,16 @@
 /***************************************************************
  * FILE NAME   : mth_camera.h
  * PURPOSE     : Camera class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_camera_h_
 #define __mth_camera_h_
 
 #include "mth_def.h"
+#include "mth_rand.h"
+#include "mth_ray.h"
+#include "mth_ray_packet.h"
 
 /* Math namespace */
 namespace mth
@@ -27,6 +30,13 @@ namespace mth
       template<typename Type2>
         friend class matr;
     public:
+      /* Screen tile (pixels rectangle) representation type */
+      struct tile
+      {
+        int X0, Y0; /* Tile left top pixel */
+        int W, H;   /* Tile width and height in pixels */
+      }; /* End of 'tile' structure */
+
       int FrameW, FrameH; /* Frame width and height */
       vec3<Type>
         Loc,              /* Camera location */
@@ -129,6 +139,116 @@ namespace mth
         return *this;
       } /* End of 'Set' function */
 
+      /* Get tile packets count function.
+       * ARGUMENTS:
+       *   - screen tile:
+       *       const tile &T;
+       * RETURNS:
+       *   (int) number of N-rays packets covering tile.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<int N>
+        constexpr static int TilePackets( const tile &T ) noexcept
+        {
+          return (T.W + N - 1) / N * T.H;
+        } /* End of 'TilePackets' function */
+
+      /* Generate tile primary rays packets function.
+       * Packets go row by row, each packet holds N neighbour pixels of one row:
+       * packet P covers pixels (X0 + (P % PacketsPerRow) * N + Lane, Y0 + P / PacketsPerRow),
+       * where PacketsPerRow = (T.W + N - 1) / N. Lanes past tile right edge repeat
+       * its last pixel. Pixel offsets are accumulated incrementally,
+       * directions are normalized for whole packet at once.
+       * ARGUMENTS:
+       *   - screen tile:
+       *       const tile &T;
+       *   - output packets array (at least 'TilePackets<N>(T)' packets):
+       *       ray_packet<Type, N> *Out;
+       *   - jitter rays inside pixels (for antialiasing) flag:
+       *       const bool Jitter = false;
+       *   - jitter sequence seed (e.g. frame or sample number):
+       *       const UINT Seed = 0;
+       * RETURNS:
+       *   (int) number of generated packets.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<int N>
+        constexpr int GenerateRays( const tile &T, ray_packet<Type, N> *Out, const bool Jitter = false, const UINT Seed = 0 ) const noexcept
+        {
+          if (T.W <= 0 || T.H <= 0)
+            return 0;
+
+          const Type
+            PixW = Wp / FrameW,
+            PixH = Hp / FrameH;
+          const vec3<Type>
+            StepX = Right * PixW,
+            StepY = Up * -PixH,
+            StepPacket = StepX * static_cast<Type>(N);
+          vec3<Type> RowStart = Dir * ProjDist +
+            StepX * (T.X0 + static_cast<Type>(0.5) - static_cast<Type>(FrameW) / 2) +
+            StepY * (T.Y0 + static_cast<Type>(0.5) - static_cast<Type>(FrameH) / 2);
+
+          /* Lanes pixel offsets inside packet */
+          const simd<Type, N> LaneInd = simd<Type, N>::Index();
+          int Cnt = 0;
+
+          for (int y = 0; y < T.H; y++, RowStart += StepY)
+          {
+            vec3<Type> Start = RowStart;
+
+            for (int x = 0; x < T.W; x += N, Start += StepPacket)
+            {
+              simd<Type, N> Ox = LaneInd, Oy(0);
+
+              /* Clamp lanes past tile edge to last pixel */
+              if (x + N > T.W)
+                Ox = Min(Ox, simd<Type, N>(static_cast<Type>(T.W - 1 - x)));
+              if (Jitter)
+                for (int i = 0; i < N; i++)
+                {
+                  const UINT Pix = static_cast<UINT>((T.Y0 + y) * FrameW + T.X0 + x + static_cast<int>(Ox[i]));
+
+                  Ox[i] += random::HashUnit<Type>(Pix * 2 + Seed * 0x9E3779B9U) - static_cast<Type>(0.5);
+                  Oy[i] = random::HashUnit<Type>(Pix * 2 + 1 + Seed * 0x9E3779B9U) - static_cast<Type>(0.5);
+                }
+
+              Out[Cnt++] = ray_packet<Type, N>(Loc,
+                simd<Type, N>(Start.X) + Ox * StepX.X + Oy * StepY.X,
+                simd<Type, N>(Start.Y) + Ox * StepX.Y + Oy * StepY.Y,
+                simd<Type, N>(Start.Z) + Ox * StepX.Z + Oy * StepY.Z);
+            }
+          }
+          return Cnt;
+        } /* End of 'GenerateRays' function */
+
+      /* Generate primary ray with differentials function.
+       * ARGUMENTS:
+       *   - frame point (continuous pixel coordinates, pixel centers at +0.5):
+       *       const Type X, Y;
+       * RETURNS:
+       *   (ray_diff<Type>) ray with derivatives by one pixel step.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_diff<Type> GenerateRay( const Type X, const Type Y ) const noexcept
+      {
+        const vec3<Type>
+          StepX = Right * (Wp / FrameW),
+          StepY = Up * -(Hp / FrameH),
+          D = Dir * ProjDist +
+            StepX * (X - static_cast<Type>(FrameW) / 2) +
+            StepY * (Y - static_cast<Type>(FrameH) / 2);
+
+        return ray_diff<Type>(ray<Type>(Loc, D), vec3<Type>(0), vec3<Type>(0),
+          ray_diff<Type>::NormalizeDiff(D, StepX), ray_diff<Type>::NormalizeDiff(D, StepY));
+      } /* End of 'GenerateRay' function */
+
     }; /* End of 'camera' class */
 } /* end of 'mth' namespace */
 
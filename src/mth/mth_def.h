@@ -1,13 +1,15 @@
 /***************************************************************
  * FILE NAME   : mth_def.h
  * PURPOSE     : Default math declarations.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_def_h_
 #define __mth_def_h_
 
 #include <cmath>
+#include <concepts>
+#include <type_traits>
 
 /* Real numbers types */
 typedef float FLT;
@@ -24,6 +26,24 @@ namespace mth
   constexpr DBL PI = 3.14159265358979323846;
   constexpr DBL D2R = PI / 180.0;
   constexpr DBL R2D = 180.0 / PI;
+
+  /* Number type concept.
+   * Built-in arithmetic types and scalar wrappers with full arithmetic
+   * and ordering (e.g. 'dual') can be used as math classes components.
+   */
+  template<typename Type>
+    concept number = std::is_arithmetic_v<Type> ||
+      requires( Type A, Type B )
+      {
+        Type(0);
+        { A + B } -> std::convertible_to<Type>;
+        { A - B } -> std::convertible_to<Type>;
+        { A * B } -> std::convertible_to<Type>;
+        { A / B } -> std::convertible_to<Type>;
+        { -A } -> std::convertible_to<Type>;
+        { A < B } -> std::convertible_to<bool>;
+        { A == B } -> std::convertible_to<bool>;
+      };
 } /* end of 'mth' namespace */
 
 #endif /* __mth_def_h_ */
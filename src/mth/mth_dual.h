@@ -0,0 +1,678 @@
+/***************************************************************
+ * FILE NAME   : mth_dual.h
+ * PURPOSE     : Forward mode automatic differentiation module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_dual_h_
+#define __mth_dual_h_
+
+#include <compare>
+#include <format>
+#include <limits>
+
+#include "mth_def.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Dual number class.
+   * Holds value and its partial derivatives by N independent variables,
+   * so one evaluation of any math class expression over 'dual' gives
+   * exact gradient of the result. Math functions are hidden friends
+   * (found by argument dependent lookup only), so unqualified calls
+   * like 'sqrt' in vec/quat/matr code pick them up without hiding
+   * standard library overloads for built-in types.
+   */
+  template<typename Type, int N = 1>
+    class dual
+    {
+      static_assert(std::is_floating_point_v<Type>, "Floating point type is needed in dual");
+      static_assert(N > 0, "Positive variables count is needed in dual");
+
+    public:
+      static const int VARIABLES = N;
+
+      Type V = 0;      // Value
+      Type D[N] = {};  // Partial derivatives
+
+      /* Class default constructor.
+       * ARGUMENTS: None.
+       */
+      constexpr dual( void ) = default;
+
+      /* Class constructor by constant.
+       * ARGUMENTS:
+       *   - constant value:
+       *       const Type Value;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr dual( const Type Value ) noexcept : V(Value)
+      {
+      } /* End of 'dual' function */
+
+      /* Class constructor by arithmetic constant.
+       * ARGUMENTS:
+       *   - constant value:
+       *       const Type2 Value;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Type2, typename = std::enable_if_t<std::is_arithmetic_v<Type2>>>
+        constexpr dual( const Type2 Value ) noexcept : V(static_cast<Type>(Value))
+        {
+        } /* End of 'dual' function */
+
+      /* Independent variable creation function.
+       * ARGUMENTS:
+       *   - variable value:
+       *       const Type Value;
+       *   - variable index (derivative by it is 1):
+       *       const int Index;
+       * RETURNS:
+       *   (dual) variable.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static dual Variable( const Type Value, const int Index ) noexcept
+      {
+        dual R(Value);
+
+        R.D[Index] = 1;
+        return R;
+      } /* End of 'Variable' function */
+
+      /* Get partial derivative function.
+       * ARGUMENTS:
+       *   - variable index:
+       *       const int Index;
+       * RETURNS:
+       *   (Type) derivative by variable.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type operator[]( const int Index ) const noexcept
+      {
+        return D[Index];
+      } /* End of 'operator[]' function */
+
+      /* Unary plus dual number function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (dual) copy of number.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr dual operator+( void ) const noexcept
+      {
+        return *this;
+      } /* End of 'operator+' function */
+
+      /* Negate dual number function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr dual operator-( void ) const noexcept
+      {
+        dual R(-V);
+
+        for (int i = 0; i < N; i++)
+          R.D[i] = -D[i];
+        return R;
+      } /* End of 'operator-' function */
+
+      /* Add dual number function.
+       * ARGUMENTS:
+       *   - number to add:
+       *       const dual &B;
+       * RETURNS:
+       *   (dual &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr dual & operator+=( const dual &B ) noexcept
+      {
+        V += B.V;
+        for (int i = 0; i < N; i++)
+          D[i] += B.D[i];
+        return *this;
+      } /* End of 'operator+=' function */
+
+      /* Subtract dual number function.
+       * ARGUMENTS:
+       *   - number to subtract:
+       *       const dual &B;
+       * RETURNS:
+       *   (dual &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr dual & operator-=( const dual &B ) noexcept
+      {
+        V -= B.V;
+        for (int i = 0; i < N; i++)
+          D[i] -= B.D[i];
+        return *this;
+      } /* End of 'operator-=' function */
+
+      /* Multiply by dual number function.
+       * ARGUMENTS:
+       *   - number to multiply by:
+       *       const dual &B;
+       * RETURNS:
+       *   (dual &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr dual & operator*=( const dual &B ) noexcept
+      {
+        for (int i = 0; i < N; i++)
+          D[i] = D[i] * B.V + V * B.D[i];
+        V *= B.V;
+        return *this;
+      } /* End of 'operator*=' function */
+
+      /* Divide by dual number function.
+       * ARGUMENTS:
+       *   - number to divide by:
+       *       const dual &B;
+       * RETURNS:
+       *   (dual &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr dual & operator/=( const dual &B ) noexcept
+      {
+        V /= B.V;
+        for (int i = 0; i < N; i++)
+          D[i] = (D[i] - V * B.D[i]) / B.V;
+        return *this;
+      } /* End of 'operator/=' function */
+
+      /* Add dual numbers function.
+       * ARGUMENTS:
+       *   - numbers to add:
+       *       dual A, const dual &B;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual operator+( dual A, const dual &B ) noexcept
+      {
+        return A += B;
+      } /* End of 'operator+' function */
+
+      /* Subtract dual numbers function.
+       * ARGUMENTS:
+       *   - numbers to subtract:
+       *       dual A, const dual &B;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual operator-( dual A, const dual &B ) noexcept
+      {
+        return A -= B;
+      } /* End of 'operator-' function */
+
+      /* Multiply dual numbers function.
+       * ARGUMENTS:
+       *   - numbers to multiply:
+       *       dual A, const dual &B;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual operator*( dual A, const dual &B ) noexcept
+      {
+        return A *= B;
+      } /* End of 'operator*' function */
+
+      /* Divide dual numbers function.
+       * ARGUMENTS:
+       *   - numbers to divide:
+       *       dual A, const dual &B;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual operator/( dual A, const dual &B ) noexcept
+      {
+        return A /= B;
+      } /* End of 'operator/' function */
+
+      /* Compare dual numbers for equality function (values only).
+       * ARGUMENTS:
+       *   - numbers to compare:
+       *       const dual &A, &B;
+       * RETURNS:
+       *   (bool) true if values are equal.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr bool operator==( const dual &A, const dual &B ) noexcept
+      {
+        return A.V == B.V;
+      } /* End of 'operator==' function */
+
+      /* Compare dual numbers function (values only).
+       * ARGUMENTS:
+       *   - numbers to compare:
+       *       const dual &A, &B;
+       * RETURNS:
+       *   (std::partial_ordering) values ordering.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr std::partial_ordering operator<=>( const dual &A, const dual &B ) noexcept
+      {
+        return A.V <=> B.V;
+      } /* End of 'operator<=>' function */
+
+    private:
+      /* Apply derivative of one argument function (chain rule).
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       *   - function value and derivative at argument value:
+       *       const Type F, DF;
+       * RETURNS:
+       *   (dual) function of argument.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static dual Chain( const dual &A, const Type F, const Type DF ) noexcept
+      {
+        dual R(F);
+
+        for (int i = 0; i < N; i++)
+          R.D[i] = DF * A.D[i];
+        return R;
+      } /* End of 'Chain' function */
+
+    public:
+      /* Square root function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual sqrt( const dual &A ) noexcept
+      {
+        const Type S = std::sqrt(A.V);
+
+        return Chain(A, S, S == 0 ? 0 : 1 / (2 * S));
+      } /* End of 'sqrt' function */
+
+      /* Square root function (scalar lane pair of 'Sqrt').
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual Sqrt( const dual &A ) noexcept
+      {
+        return sqrt(A);
+      } /* End of 'Sqrt' function */
+
+      /* Cube root function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual cbrt( const dual &A ) noexcept
+      {
+        const Type C = std::cbrt(A.V);
+
+        return Chain(A, C, C == 0 ? 0 : 1 / (3 * C * C));
+      } /* End of 'cbrt' function */
+
+      /* Exponent function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual exp( const dual &A ) noexcept
+      {
+        const Type E = std::exp(A.V);
+
+        return Chain(A, E, E);
+      } /* End of 'exp' function */
+
+      /* Natural logarithm function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual log( const dual &A ) noexcept
+      {
+        return Chain(A, std::log(A.V), 1 / A.V);
+      } /* End of 'log' function */
+
+      /* Power by constant exponent function.
+       * ARGUMENTS:
+       *   - base:
+       *       const dual &A;
+       *   - exponent:
+       *       const Type P;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual pow( const dual &A, const Type P ) noexcept
+      {
+        return Chain(A, std::pow(A.V, P), P == 0 ? 0 : P * std::pow(A.V, P - 1));
+      } /* End of 'pow' function */
+
+      /* Power function.
+       * ARGUMENTS:
+       *   - base:
+       *       const dual &A;
+       *   - exponent:
+       *       const dual &P;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual pow( const dual &A, const dual &P ) noexcept
+      {
+        dual R = pow(A, P.V);
+        const Type Ln = A.V > 0 ? std::log(A.V) : 0;
+
+        for (int i = 0; i < N; i++)
+          R.D[i] += R.V * Ln * P.D[i];
+        return R;
+      } /* End of 'pow' function */
+
+      /* Sine function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual sin( const dual &A ) noexcept
+      {
+        return Chain(A, std::sin(A.V), std::cos(A.V));
+      } /* End of 'sin' function */
+
+      /* Cosine function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual cos( const dual &A ) noexcept
+      {
+        return Chain(A, std::cos(A.V), -std::sin(A.V));
+      } /* End of 'cos' function */
+
+      /* Tangent function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual tan( const dual &A ) noexcept
+      {
+        const Type T = std::tan(A.V);
+
+        return Chain(A, T, 1 + T * T);
+      } /* End of 'tan' function */
+
+      /* Arcsine function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual asin( const dual &A ) noexcept
+      {
+        return Chain(A, std::asin(A.V), 1 / std::sqrt(1 - A.V * A.V));
+      } /* End of 'asin' function */
+
+      /* Arccosine function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual acos( const dual &A ) noexcept
+      {
+        return Chain(A, std::acos(A.V), -1 / std::sqrt(1 - A.V * A.V));
+      } /* End of 'acos' function */
+
+      /* Arctangent function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual atan( const dual &A ) noexcept
+      {
+        return Chain(A, std::atan(A.V), 1 / (1 + A.V * A.V));
+      } /* End of 'atan' function */
+
+      /* Two argument arctangent function.
+       * ARGUMENTS:
+       *   - ordinate and abscissa:
+       *       const dual &Y, &X;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual atan2( const dual &Y, const dual &X ) noexcept
+      {
+        const Type R2 = X.V * X.V + Y.V * Y.V;
+        dual R(std::atan2(Y.V, X.V));
+
+        if (R2 != 0)
+          for (int i = 0; i < N; i++)
+            R.D[i] = (X.V * Y.D[i] - Y.V * X.D[i]) / R2;
+        return R;
+      } /* End of 'atan2' function */
+
+      /* Absolute value function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual abs( const dual &A ) noexcept
+      {
+        return A.V < 0 ? -A : A;
+      } /* End of 'abs' function */
+
+      /* Absolute value function (scalar lane pair of 'Abs').
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual Abs( const dual &A ) noexcept
+      {
+        return A.V < 0 ? -A : A;
+      } /* End of 'Abs' function */
+
+      /* Minimum function (scalar lane pair of 'Min').
+       * ARGUMENTS:
+       *   - numbers to compare:
+       *       const dual &A, &B;
+       * RETURNS:
+       *   (dual) minimal number.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual Min( const dual &A, const dual &B ) noexcept
+      {
+        return A.V < B.V ? A : B;
+      } /* End of 'Min' function */
+
+      /* Maximum function (scalar lane pair of 'Max').
+       * ARGUMENTS:
+       *   - numbers to compare:
+       *       const dual &A, &B;
+       * RETURNS:
+       *   (dual) maximal number.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual Max( const dual &A, const dual &B ) noexcept
+      {
+        return A.V > B.V ? A : B;
+      } /* End of 'Max' function */
+
+      /* Floor function (derivative is zero almost everywhere).
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual floor( const dual &A ) noexcept
+      {
+        return dual(std::floor(A.V));
+      } /* End of 'floor' function */
+
+      /* Ceil function (derivative is zero almost everywhere).
+       * ARGUMENTS:
+       *   - argument:
+       *       const dual &A;
+       * RETURNS:
+       *   (dual) result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      friend constexpr dual ceil( const dual &A ) noexcept
+      {
+        return dual(std::ceil(A.V));
+      } /* End of 'ceil' function */
+    }; /* End of 'dual' class */
+} /* end of 'mth' namespace */
+
+/* Standard namespace */
+namespace std
+{
+  /* Dual number limits (taken from value type) */
+  template<typename Type, int N>
+    struct numeric_limits<mth::dual<Type, N>> : public numeric_limits<Type>
+    {
+    }; /* End of 'numeric_limits' structure */
+
+#ifndef __CUDA__
+  /* Dual number formatter (prints value with value type format specification, derivatives are omitted) */
+  template<typename Type, int N, typename CharType>
+    struct formatter<mth::dual<Type, N>, CharType> : public formatter<Type, CharType>
+    {
+      /* Format function.
+       * ARGUMENTS:
+       *   - dual number to format:
+       *       const mth::dual<Type, N> &A;
+       *   - format context:
+       *       FormatContext &Ctx;
+       * RETURNS:
+       *   (auto) output iterator.
+       */
+      template<typename FormatContext>
+        auto format( const mth::dual<Type, N> &A, FormatContext &Ctx ) const
+        {
+          return formatter<Type, CharType>::format(A.V, Ctx);
+        } /* End of 'format' function */
+    }; /* End of 'formatter' structure */
+#endif /* __CUDA__ */
+} /* end of 'std' namespace */
+
+#endif /* __mth_dual_h_ */
+
+/* END OF 'mth_dual.h' FILE */
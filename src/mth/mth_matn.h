@@ -0,0 +1,647 @@
+/***************************************************************
+ * FILE NAME   : mth_matn.h
+ * PURPOSE     : Small dense matrix and linear solvers module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_matn_h_
+#define __mth_matn_h_
+
+#include "mth_def.h"
+#include "mth_simd.h"
+#include "mth_parallel.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Small dense square matrix class.
+   * Factorizations (LU with partial pivoting, Cholesky, Householder QR)
+   * are written once for lanes type: plain number for single matrix and
+   * simd lanes for 'pack' (interleaved matrices, one per lane), pivoting
+   * and singular cases are handled by masks so all lanes run same code.
+   */
+  template<int N, typename Type = DBL>
+    class matn
+    {
+      static_assert(number<Type>, "Number type is needed in matn");
+      static_assert(N > 0 && N <= 12, "Size in [1, 12] is needed in matn");
+
+    public:
+      static const int SIZE = N;
+
+      Type A[N][N] {}; // Matrix elements (row major)
+
+      /* Interleaved matrices pack (array of structures of arrays) type */
+      template<int L>
+        struct pack
+        {
+          simd<Type, L> A[N][N]; // Elements lanes (lane I holds matrix I)
+
+          /* Store matrix to lane function.
+           * ARGUMENTS:
+           *   - lane index:
+           *       const int Lane;
+           *   - matrix:
+           *       const matn &M;
+           * RETURNS: None.
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr void Set( const int Lane, const matn &M ) noexcept
+          {
+            for (int i = 0; i < N; i++)
+              for (int j = 0; j < N; j++)
+                A[i][j][Lane] = M.A[i][j];
+          } /* End of 'Set' function */
+
+          /* Load matrix from lane function.
+           * ARGUMENTS:
+           *   - lane index:
+           *       const int Lane;
+           * RETURNS:
+           *   (matn) lane matrix.
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr matn Get( const int Lane ) const noexcept
+          {
+            matn M;
+
+            for (int i = 0; i < N; i++)
+              for (int j = 0; j < N; j++)
+                M.A[i][j] = A[i][j][Lane];
+            return M;
+          } /* End of 'Get' function */
+        }; /* End of 'pack' structure */
+
+      /* LU factorization with partial pivoting (P * A = L * U) type */
+      template<typename Lane>
+        struct lu
+        {
+          using mask = decltype(Lane(0) == Lane(0));
+
+          Lane M[N][N]; // L (unit diagonal, below) and U (diagonal and above)
+          Lane Piv[N];  // Row swapped with row K at step K
+          mask Ok;      // Non singular flags
+
+          /* Factorize matrix constructor.
+           * ARGUMENTS:
+           *   - matrix elements:
+           *       const Lane (&Src)[N][N];
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr lu( const Lane (&Src)[N][N] ) noexcept : Ok(Lane(0) == Lane(0))
+          {
+            for (int i = 0; i < N; i++)
+              for (int j = 0; j < N; j++)
+                M[i][j] = Src[i][j];
+
+            for (int k = 0; k < N; k++)
+            {
+              /* Pivot search */
+              Lane Best = Abs(M[k][k]), P(static_cast<Type>(k));
+
+              for (int r = k + 1; r < N; r++)
+              {
+                const auto IsBetter = Abs(M[r][k]) > Best;
+
+                Best = Select(IsBetter, Abs(M[r][k]), Best);
+                P = Select(IsBetter, Lane(static_cast<Type>(r)), P);
+              }
+              Piv[k] = P;
+              Ok = Ok & (Best != Lane(0));
+
+              /* Rows swap */
+              for (int r = k + 1; r < N; r++)
+              {
+                const auto IsSwap = P == Lane(static_cast<Type>(r));
+
+                for (int c = 0; c < N; c++)
+                {
+                  const Lane T = M[r][c];
+
+                  M[r][c] = Select(IsSwap, M[k][c], T);
+                  M[k][c] = Select(IsSwap, T, M[k][c]);
+                }
+              }
+
+              /* Elimination */
+              const Lane Inv = Lane(1) / Select(M[k][k] == Lane(0), Lane(1), M[k][k]);
+
+              for (int r = k + 1; r < N; r++)
+              {
+                M[r][k] *= Inv;
+                for (int c = k + 1; c < N; c++)
+                  M[r][c] -= M[r][k] * M[k][c];
+              }
+            }
+          } /* End of 'lu' function */
+
+          /* Solve system function.
+           * ARGUMENTS:
+           *   - right hand side:
+           *       const Lane *B;
+           *   - solution (may be same as B):
+           *       Lane *X;
+           * RETURNS: None.
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr void Solve( const Lane *B, Lane *X ) const noexcept
+          {
+            Lane Y[N];
+
+            for (int i = 0; i < N; i++)
+              Y[i] = B[i];
+            for (int k = 0; k < N; k++)
+              for (int r = k + 1; r < N; r++)
+              {
+                const auto IsSwap = Piv[k] == Lane(static_cast<Type>(r));
+                const Lane T = Y[r];
+
+                Y[r] = Select(IsSwap, Y[k], T);
+                Y[k] = Select(IsSwap, T, Y[k]);
+              }
+            for (int i = 1; i < N; i++)
+              for (int j = 0; j < i; j++)
+                Y[i] -= M[i][j] * Y[j];
+            for (int i = N - 1; i >= 0; i--)
+            {
+              for (int j = i + 1; j < N; j++)
+                Y[i] -= M[i][j] * Y[j];
+              Y[i] /= Select(M[i][i] == Lane(0), Lane(1), M[i][i]);
+            }
+            for (int i = 0; i < N; i++)
+              X[i] = Y[i];
+          } /* End of 'Solve' function */
+
+          /* Get matrix determinant function.
+           * ARGUMENTS: None.
+           * RETURNS:
+           *   (Lane) determinant.
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr Lane Determinant( void ) const noexcept
+          {
+            Lane D(1);
+
+            for (int k = 0; k < N; k++)
+              D *= Select(Piv[k] == Lane(static_cast<Type>(k)), M[k][k], -M[k][k]);
+            return D;
+          } /* End of 'Determinant' function */
+        }; /* End of 'lu' structure */
+
+      /* Cholesky factorization of symmetric positive definite matrix (A = L * L^T) type */
+      template<typename Lane>
+        struct cholesky
+        {
+          using mask = decltype(Lane(0) == Lane(0));
+
+          Lane L[N][N]; // Lower triangle factor (upper part is unused)
+          mask Ok;      // Positive definite flags
+
+          /* Factorize matrix constructor (lower triangle of matrix is used).
+           * ARGUMENTS:
+           *   - matrix elements:
+           *       const Lane (&Src)[N][N];
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr cholesky( const Lane (&Src)[N][N] ) noexcept : L {}, Ok(Lane(0) == Lane(0))
+          {
+            for (int j = 0; j < N; j++)
+            {
+              Lane D = Src[j][j];
+
+              for (int k = 0; k < j; k++)
+                D -= L[j][k] * L[j][k];
+              Ok = Ok & (D > Lane(0));
+              L[j][j] = Sqrt(Select(D > Lane(0), D, Lane(1)));
+
+              const Lane Inv = Lane(1) / L[j][j];
+
+              for (int i = j + 1; i < N; i++)
+              {
+                Lane S = Src[i][j];
+
+                for (int k = 0; k < j; k++)
+                  S -= L[i][k] * L[j][k];
+                L[i][j] = S * Inv;
+              }
+            }
+          } /* End of 'cholesky' function */
+
+          /* Solve system function.
+           * ARGUMENTS:
+           *   - right hand side:
+           *       const Lane *B;
+           *   - solution (may be same as B):
+           *       Lane *X;
+           * RETURNS: None.
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr void Solve( const Lane *B, Lane *X ) const noexcept
+          {
+            Lane Y[N];
+
+            for (int i = 0; i < N; i++)
+            {
+              Y[i] = B[i];
+              for (int k = 0; k < i; k++)
+                Y[i] -= L[i][k] * Y[k];
+              Y[i] /= L[i][i];
+            }
+            for (int i = N - 1; i >= 0; i--)
+            {
+              for (int k = i + 1; k < N; k++)
+                Y[i] -= L[k][i] * Y[k];
+              Y[i] /= L[i][i];
+            }
+            for (int i = 0; i < N; i++)
+              X[i] = Y[i];
+          } /* End of 'Solve' function */
+        }; /* End of 'cholesky' structure */
+
+      /* Householder QR factorization (A = Q * R) type */
+      template<typename Lane>
+        struct qr
+        {
+          using mask = decltype(Lane(0) == Lane(0));
+
+          Lane M[N][N]; // R above diagonal and reflectors vectors on and below diagonal
+          Lane Diag[N]; // R diagonal
+          Lane Beta[N]; // Reflectors scales (H = I - Beta * V * V^T)
+          mask Ok;      // Full rank flags
+
+          /* Factorize matrix constructor.
+           * ARGUMENTS:
+           *   - matrix elements:
+           *       const Lane (&Src)[N][N];
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr qr( const Lane (&Src)[N][N] ) noexcept : Ok(Lane(0) == Lane(0))
+          {
+            for (int i = 0; i < N; i++)
+              for (int j = 0; j < N; j++)
+                M[i][j] = Src[i][j];
+
+            for (int k = 0; k < N; k++)
+            {
+              Lane Norm2(0);
+
+              for (int i = k; i < N; i++)
+                Norm2 += M[i][k] * M[i][k];
+
+              /* Reflect column to -sign(X0) * |X| * E0 (no cancellation) */
+              const Lane
+                Norm = Sqrt(Norm2),
+                Alpha = Select(M[k][k] > Lane(0), -Norm, Norm),
+                V2 = (Norm2 - M[k][k] * Alpha) * Lane(2),
+                B = Select(V2 != Lane(0), Lane(2) / Select(V2 != Lane(0), V2, Lane(1)), Lane(0));
+
+              M[k][k] -= Alpha;
+              Diag[k] = Alpha;
+              Beta[k] = B;
+              Ok = Ok & (Norm != Lane(0));
+
+              for (int c = k + 1; c < N; c++)
+              {
+                Lane S(0);
+
+                for (int i = k; i < N; i++)
+                  S += M[i][k] * M[i][c];
+                S *= B;
+                for (int i = k; i < N; i++)
+                  M[i][c] -= S * M[i][k];
+              }
+            }
+          } /* End of 'qr' function */
+
+          /* Solve system function.
+           * ARGUMENTS:
+           *   - right hand side:
+           *       const Lane *B;
+           *   - solution (may be same as B):
+           *       Lane *X;
+           * RETURNS: None.
+           */
+#ifdef __CUDA__
+          __host__ __device__
+#endif /* __CUDA__ */
+          constexpr void Solve( const Lane *B, Lane *X ) const noexcept
+          {
+            Lane Y[N];
+
+            for (int i = 0; i < N; i++)
+              Y[i] = B[i];
+
+            /* Y = Q^T * B */
+            for (int k = 0; k < N; k++)
+            {
+              Lane S(0);
+
+              for (int i = k; i < N; i++)
+                S += M[i][k] * Y[i];
+              S *= Beta[k];
+              for (int i = k; i < N; i++)
+                Y[i] -= S * M[i][k];
+            }
+
+            /* R * X = Y */
+            for (int i = N - 1; i >= 0; i--)
+            {
+              for (int j = i + 1; j < N; j++)
+                Y[i] -= M[i][j] * Y[j];
+              Y[i] /= Select(Diag[i] == Lane(0), Lane(1), Diag[i]);
+            }
+            for (int i = 0; i < N; i++)
+              X[i] = Y[i];
+          } /* End of 'Solve' function */
+        }; /* End of 'qr' structure */
+
+      /* Class default constructor */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr matn( void ) = default;
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - matrix elements (row major):
+       *       const Type (&Src)[N][N];
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr matn( const Type (&Src)[N][N] ) noexcept
+      {
+        for (int i = 0; i < N; i++)
+          for (int j = 0; j < N; j++)
+            A[i][j] = Src[i][j];
+      } /* End of 'matn' function */
+
+      /* Get identity matrix function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (matn) identity matrix.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static matn Identity( void ) noexcept
+      {
+        matn M;
+
+        for (int i = 0; i < N; i++)
+          M.A[i][i] = 1;
+        return M;
+      } /* End of 'Identity' function */
+
+      /* Matrix rows access function.
+       * ARGUMENTS:
+       *   - row index:
+       *       const int Row;
+       * RETURNS:
+       *   (Type *) row elements.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type * operator[]( const int Row ) noexcept
+      {
+        return A[Row];
+      } /* End of 'operator[]' function */
+
+      /* Matrix rows access function.
+       * ARGUMENTS:
+       *   - row index:
+       *       const int Row;
+       * RETURNS:
+       *   (const Type *) row elements.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr const Type * operator[]( const int Row ) const noexcept
+      {
+        return A[Row];
+      } /* End of 'operator[]' function */
+
+      /* Matrices multiplication function.
+       * ARGUMENTS:
+       *   - matrix to multiply by:
+       *       const matn &M;
+       * RETURNS:
+       *   (matn) result matrix.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr matn operator*( const matn &M ) const noexcept
+      {
+        matn R;
+
+        for (int i = 0; i < N; i++)
+          for (int k = 0; k < N; k++)
+            for (int j = 0; j < N; j++)
+              R.A[i][j] += A[i][k] * M.A[k][j];
+        return R;
+      } /* End of 'operator*' function */
+
+      /* Matrix by vector multiplication function.
+       * ARGUMENTS:
+       *   - vector:
+       *       const Type *X;
+       *   - result vector:
+       *       Type *Y;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr void Apply( const Type *X, Type *Y ) const noexcept
+      {
+        for (int i = 0; i < N; i++)
+        {
+          Type S = 0;
+
+          for (int j = 0; j < N; j++)
+            S += A[i][j] * X[j];
+          Y[i] = S;
+        }
+      } /* End of 'Apply' function */
+
+      /* Get transposed matrix function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (matn) transposed matrix.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr matn Transpose( void ) const noexcept
+      {
+        matn M;
+
+        for (int i = 0; i < N; i++)
+          for (int j = 0; j < N; j++)
+            M.A[i][j] = A[j][i];
+        return M;
+      } /* End of 'Transpose' function */
+
+      /* Get LU factorization function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (lu<Type>) factorization.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr lu<Type> LU( void ) const noexcept
+      {
+        return lu<Type>(A);
+      } /* End of 'LU' function */
+
+      /* Get Cholesky factorization function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (cholesky<Type>) factorization.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr cholesky<Type> Cholesky( void ) const noexcept
+      {
+        return cholesky<Type>(A);
+      } /* End of 'Cholesky' function */
+
+      /* Get Householder QR factorization function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (qr<Type>) factorization.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr qr<Type> QR( void ) const noexcept
+      {
+        return qr<Type>(A);
+      } /* End of 'QR' function */
+
+      /* Solve linear system (LU with partial pivoting) function.
+       * ARGUMENTS:
+       *   - right hand side:
+       *       const Type *B;
+       *   - solution:
+       *       Type *X;
+       * RETURNS:
+       *   (bool) true if matrix is non singular.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr bool Solve( const Type *B, Type *X ) const noexcept
+      {
+        const lu<Type> F(A);
+
+        F.Solve(B, X);
+        return F.Ok;
+      } /* End of 'Solve' function */
+
+      /* Get matrix determinant function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (Type) determinant.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type operator!( void ) const noexcept
+      {
+        return lu<Type>(A).Determinant();
+      } /* End of 'operator!' function */
+
+      /* Get inverse matrix function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (matn) inverse matrix (undefined for singular matrix).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr matn Inverse( void ) const noexcept
+      {
+        const lu<Type> F(A);
+        matn R;
+
+        for (int j = 0; j < N; j++)
+        {
+          Type E[N] {}, X[N];
+
+          E[j] = 1;
+          F.Solve(E, X);
+          for (int i = 0; i < N; i++)
+            R.A[i][j] = X[i];
+        }
+        return R;
+      } /* End of 'Inverse' function */
+
+      /* Solve interleaved systems array function.
+       * Packs are split between threads, every pack is factorized and
+       * solved at SIMD width.
+       * ARGUMENTS:
+       *   - matrices packs:
+       *       const pack<L> *Packs;
+       *   - right hand sides (N lanes per pack):
+       *       const simd<Type, L> *B;
+       *   - solutions (N lanes per pack, may be same as B):
+       *       simd<Type, L> *X;
+       *   - number of packs:
+       *       const int Count;
+       *   - solver (lu, cholesky or qr):
+       *       template<typename> typename Factor;
+       * RETURNS:
+       *   (int) number of packs with singular lanes.
+       */
+      template<template<typename> typename Factor = lu, int L>
+        static int Solve( const pack<L> *Packs, const simd<Type, L> *B, simd<Type, L> *X, const int Count )
+        {
+          int Failed[64] {};
+
+          const int Chunks = parallel::For(0, Count,
+            [&]( const int Begin, const int End, const int Chunk )
+            {
+              for (int i = Begin; i < End; i++)
+              {
+                const Factor<simd<Type, L>> F(Packs[i].A);
+
+                F.Solve(B + static_cast<size_t>(i) * N, X + static_cast<size_t>(i) * N);
+                Failed[Chunk] += !F.Ok.All();
+              }
+            }, 64, 64);
+
+          int Res = 0;
+
+          for (int i = 0; i < Chunks; i++)
+            Res += Failed[i];
+          return Res;
+        } /* End of 'Solve' function */
+
+    }; /* End of 'matn' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_matn_h_ */
+
+/* END OF 'mth_matn.h' FILE */
@@ -1,12 +1,13 @@
 /***************************************************************
  * FILE NAME   : mth_matr.h
  * PURPOSE     : Matrix 4x4 class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_matr_h_
 #define __mth_matr_h_
 
+#include <algorithm>
 #include <vector>
 
 #include "mth_def.h"
@@ -22,8 +23,12 @@ namespace mth
   template<typename Type>
     class matr
     {
+      static_assert(number<Type>, "Number type is needed in matr");
+
       template<typename Type2>
         friend class camera;
+      template<typename Type2>
+        friend class matr;
 
     private:
       Type A[4][4] = {};
@@ -155,7 +160,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr matr( const Type Arr[] ) noexcept
       {
-        memcpy(A, Arr, 16 * sizeof(Type));
+        std::copy_n(Arr, 16, A[0]);
       } /* End of 'matr' function */
 
       /* Matrix constructor by 2-dimensional array.
@@ -168,7 +173,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr matr( const Type Arr[4][4] ) noexcept
       {
-        memcpy(A, Arr, 16 * sizeof(Type));
+        std::copy_n(Arr[0], 16, A[0]);
       } /* End of 'matr' function */
 
       /* Matrix constructor by initializer list.
@@ -181,7 +186,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr matr( const std::vector<Type> &List ) noexcept
       {
-        memcpy(A, List.data(), 16 * sizeof(Type));
+        std::copy_n(List.data(), 16, A[0]);
       } /* End of 'matr' function */
 
       /* Matr constructor by 2-dimensional array.
@@ -196,7 +201,7 @@ namespace mth
         constexpr matr( const matr<Type1> &M ) noexcept
         {
           if constexpr (std::is_same_v<Type, Type1>)
-            memcpy(A, M.A, 16 * sizeof(Type));
+            std::copy_n(M.A[0], 16, A[0]);
           else
           {
             A[0][0] = static_cast<Type>(M.A[0][0]);
@@ -677,7 +682,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec3<Type> Transform4x4( const vec3<Type> &V ) const noexcept
       {
-        const DBL w = 1 / (V[0] * A[0][3] + V[1] * A[1][3] + V[2] * A[2][3] + A[3][3]);
+        const Type w = 1 / (V[0] * A[0][3] + V[1] * A[1][3] + V[2] * A[2][3] + A[3][3]);
 
         return vec3<Type>(
           (V[0] * A[0][0] + V[1] * A[1][0] + V[2] * A[2][0] + A[3][0]) * w,
@@ -1,17 +1,30 @@
 /***************************************************************
  * FILE NAME   : mth_noise.h
  * PURPOSE     : Noise generators class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_noise_h_
 #define __mth_noise_h_
 
+#include <cmath>
+
 #include "mth_def.h"
+#include "mth_rand.h"
+#include "mth_simd.h"
+#include "mth_parallel.h"
 
 /* Math namespace */
 namespace mth
 {
+  /* Forward declaration */
+  template<typename Type>
+    class vec2;
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class vec4;
+
   /* Noise class */
   template<typename Type>
     class noise
@@ -23,19 +36,91 @@ namespace mth
       static const int TAB_SIZE = 1 << TAB_BITS;
       static const int TAB_MASK = TAB_SIZE - 1;
 
+      static constexpr Type NOISE_MEAN = static_cast<Type>(0.5); // Table noise mean value
+      static constexpr UINT DEFAULT_SEED = 30102;                   // Table seed used by default constructor
+      static const int PARALLEL_MIN = 4096;                         // Minimal texels count per thread in grid fill
+
       Type TabNoise[TAB_SIZE][TAB_SIZE];
 
+    private:
+      /* Floor to integer function (constexpr replacement of 'floor').
+       * ARGUMENTS:
+       *   - number to floor:
+       *       const Type2 X;
+       * RETURNS:
+       *   (int) greatest integer not above X.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Type2>
+        constexpr static int FloorInt( const Type2 X ) noexcept
+        {
+          const int I = static_cast<int>(X);
+
+          return I > X ? I - 1 : I;
+        } /* End of 'FloorInt' function */
+
+    public:
+
+      /* Get number of octaves resolved by sample footprint function.
+       * Octave I has lattice cell 2^-I, it is kept while cell covers at least
+       * two footprints and faded out linearly during the next octave. Octaves
+       * below footprint are replaced by noise mean (their filtered value), so
+       * distant samples are cheaper and do not alias.
+       * ARGUMENTS:
+       *   - maximal number of octaves:
+       *       const int Octaves;
+       *   - sample footprint in noise space (0 - no filtering):
+       *       const Type2 Footprint;
+       * RETURNS:
+       *   (Type2) fractional number of octaves in [0, Octaves].
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Type2>
+        constexpr static Type2 OctavesLod( const int Octaves, const Type2 Footprint ) noexcept
+        {
+          if (Footprint <= 0)
+            return Octaves;
+
+          const Type2 Lod = -std::log2(Footprint);
+
+          return Lod <= 0 ? 0 : Lod >= Octaves ? Octaves : Lod;
+        } /* End of 'OctavesLod' function */
+
       /* Class default constructor.
        * ARGUMENTS: None.
        */
 #ifdef __CUDA__
       __host__ __device__
 #endif /* __CUDA__ */
-      constexpr noise( void ) noexcept
+      constexpr noise( void ) noexcept : noise(DEFAULT_SEED)
       {
+      } /* End of 'noise' function */
+
+      /* Class constructor by table seed.
+       * Table is filled by 'random::pcg' sequence, so it is same for same seed
+       * in every process and can be built at compile time:
+       *   constexpr noise<FLT> Noise(Seed);
+       * (table has TAB_SIZE^2 values, so it exceeds default compiler constexpr
+       * evaluation limits: projects set MSVC '/constexpr:steps', clang needs
+       * '-fconstexpr-steps' raised same way).
+       * ARGUMENTS:
+       *   - table seed:
+       *       const UINT Seed;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      explicit constexpr noise( const UINT Seed ) noexcept
+      {
+        random::pcg Rnd(Seed);
+
         for (int i = 0; i < TAB_SIZE; i++)
           for (int j = 0; j < TAB_SIZE; j++)
-            TabNoise[j][i] = static_cast<Type>(rand()) / RAND_MAX;
+            TabNoise[i][j] = Rnd.Unit<Type>();
       } /* End of 'noise' function */
 
       /* Get 1D noise function.
@@ -50,7 +135,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr Type Noise1D( const Type X ) const noexcept
       {
-        int ix = floor(X), ix1;
+        int ix = FloorInt(X), ix1;
         const Type fx = X - ix;
 
         ix &= TAB_MASK;
@@ -73,16 +158,37 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr Type NoiseTurb1D( const Type X, const int Octaves ) const noexcept
       {
-         int i, frac = 1;
-         Type val = 0;
+        return NoiseTurb1D(X, Octaves, 0);
+      } /* End of 'NoiseTurb1D' function */
+
+      /* Noise 1D turb with level-of-detail function.
+       * ARGUMENTS:
+       *   - number to create noise:
+       *       const Type X;
+       *   - maximal number of octaves:
+       *       const int Octaves;
+       *   - sample footprint in noise space (e.g. 'ray_diff::Footprint' by noise scale, 0 - no filtering):
+       *       const Type Footprint;
+       * RETURNS:
+       *   (Type) result noise.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type NoiseTurb1D( const Type X, const int Octaves, const Type Footprint ) const noexcept
+      {
+        const Type Lod = OctavesLod(Octaves, Footprint);
+        Type val = 0, x = X, frac = 1;
 
-         for (i = 0; i < Octaves; i++)
-         {
-           val += Noise1D(X) / frac;
-           X = (X + 29.47) * 2;
-           frac *= 2;
-         }
-         return val * (1 << (Octaves - 1)) / ((1 << Octaves) - 1);
+        for (int i = 0; i < Octaves; i++)
+        {
+          const Type W = Lod >= i + 1 ? 1 : Lod <= i ? 0 : Lod - i;
+
+          val += (W == 0 ? NOISE_MEAN : W == 1 ? Noise1D(x) : NOISE_MEAN + (Noise1D(x) - NOISE_MEAN) * W) / frac;
+          x = (x + static_cast<Type>(29.47)) * 2;
+          frac *= 2;
+        }
+        return val * (1 << (Octaves - 1)) / ((1 << Octaves) - 1);
       } /* End of 'NoiseTurb1D' function */
 
       /* Get 2D noise function.
@@ -97,7 +203,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr DBL Noise2D( const DBL X, const DBL Y ) const noexcept
       {
-        int ix = int(floor(X)), ix1, iy = int(floor(Y)), iy1;
+        int ix = FloorInt(X), ix1, iy = FloorInt(Y), iy1;
         DBL fx, fy;
 
         fx = X - ix;
@@ -130,20 +236,1201 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr DBL NoiseTurb2D( const DBL X, const DBL Y, const int Octaves ) const noexcept
       {
-        int i, frac = 1;
-        DBL val = 0;
+        return NoiseTurb2D(X, Y, Octaves, 0);
+      } /* End of 'NoiseTurb2D' function */
 
-        for (i = 0; i < Octaves; i++)
+      /* Noise 2D turb with level-of-detail function.
+       * ARGUMENTS:
+       *   - noise arguments:
+       *       const DBL X, Y;
+       *   - maximal number of octaves:
+       *       const int Octaves;
+       *   - sample footprint in noise space (e.g. 'ray_diff::Footprint' by noise scale, 0 - no filtering):
+       *       const DBL Footprint;
+       * RETURNS:
+       *   (DBL) turbulence value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr DBL NoiseTurb2D( const DBL X, const DBL Y, const int Octaves, const DBL Footprint ) const noexcept
+      {
+        const DBL Lod = OctavesLod(Octaves, Footprint);
+        DBL val = 0, x = X, y = Y, frac = 1;
+
+        for (int i = 0; i < Octaves; i++)
         {
-          val += Noise2D(X, Y) / frac;
-          X = (X + 29.47) * 2;
-          Y = (Y + 18.102) * 2;
+          const DBL W = Lod >= i + 1 ? 1 : Lod <= i ? 0 : Lod - i;
+
+          val += (W == 0 ? NOISE_MEAN : W == 1 ? Noise2D(x, y) : NOISE_MEAN + (Noise2D(x, y) - NOISE_MEAN) * W) / frac;
+          x = (x + 29.47) * 2;
+          y = (y + 18.102) * 2;
           frac *= 2;
         }
         return val * (1 << (Octaves - 1)) / ((1 << Octaves) - 1);
       } /* End of 'NoiseTurb2D' function */
 
+      /* Get 2D noise for N lanes function.
+       * Same as scalar 'Noise2D' evaluated in Type precision.
+       * ARGUMENTS:
+       *   - noise arguments lanes:
+       *       const simd<Type, N> &X, &Y;
+       * RETURNS:
+       *   (simd<Type, N>) noise values.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<int N>
+        constexpr simd<Type, N> Noise2D( const simd<Type, N> &X, const simd<Type, N> &Y ) const noexcept
+        {
+          using lanes = simd<Type, N>;
+          const lanes
+            One(1), Size(TAB_SIZE), RevSize(static_cast<Type>(1.0 / TAB_SIZE)),
+            FloorX = Floor(X), FloorY = Floor(Y),
+            /* Lattice coordinates modulo table size (exact for integer lanes) */
+            WrapX = FloorX - Floor(FloorX * RevSize) * Size,
+            WrapY = FloorY - Floor(FloorY * RevSize) * Size,
+            WrapX1 = Select(WrapX + One == Size, lanes(0), WrapX + One),
+            WrapY1 = Select(WrapY + One == Size, lanes(0), WrapY + One),
+            Fx = X - FloorX, Fy = Y - FloorY,
+            Sx = (lanes(3) - Fx - Fx) * Fx * Fx,
+            Sy = (lanes(3) - Fy - Fy) * Fy * Fy;
+          const simd<int, N>
+            Ix(WrapX * Size), Ix1(WrapX1 * Size),
+            Iy(WrapY), Iy1(WrapY1);
+          const Type *Tab = &TabNoise[0][0];
+          const lanes
+            V00 = Gather(Tab, Ix + Iy), V10 = Gather(Tab, Ix1 + Iy),
+            V01 = Gather(Tab, Ix + Iy1), V11 = Gather(Tab, Ix1 + Iy1),
+            V0 = V00 + (V10 - V00) * Sx,
+            V1 = V01 + (V11 - V01) * Sx;
+
+          return V0 + (V1 - V0) * Sy;
+        } /* End of 'Noise2D' function */
+
+      /* Noise 2D turb for N lanes function.
+       * ARGUMENTS:
+       *   - noise arguments lanes:
+       *       const simd<Type, N> &X, &Y;
+       *   - number of octaves:
+       *       const int Octaves;
+       * RETURNS:
+       *   (simd<Type, N>) turbulence values.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<int N>
+        constexpr simd<Type, N> NoiseTurb2D( const simd<Type, N> &X, const simd<Type, N> &Y, const int Octaves ) const noexcept
+        {
+          using lanes = simd<Type, N>;
+          const lanes OffX(static_cast<Type>(29.47)), OffY(static_cast<Type>(18.102)), Two(2);
+          lanes val(0), x = X, y = Y;
+          Type frac = 1;
+
+          for (int i = 0; i < Octaves; i++)
+          {
+            val += Noise2D(x, y) * lanes(1 / frac);
+            x = (x + OffX) * Two;
+            y = (y + OffY) * Two;
+            frac *= 2;
+          }
+          return val * lanes(static_cast<Type>((1 << (Octaves - 1)) / static_cast<DBL>((1 << Octaves) - 1)));
+        } /* End of 'NoiseTurb2D' function */
+
+      /* Fill 2D grid by turbulence function.
+       * Rows are split between threads, texels in row are processed by
+       * N lanes packs ('simd' maps to AVX2/AVX-512 vectors, table lookups
+       * are gathers). Lanes are evaluated in Type precision while scalar
+       * 'NoiseTurb2D' uses DBL, so for Type = DBL results are same up to
+       * rounding (1e-12) and for Type = FLT texels differ from scalar by at
+       * most about Octaves * 2^-23 * (|X| + |Y| + 64) (1e-4 for coordinates
+       * below 100 and 8 octaves).
+       * ARGUMENTS:
+       *   - first texel (top left) noise coordinates:
+       *       const vec2<Type> &Origin;
+       *   - texels step in noise space:
+       *       const vec2<Type> &Step;
+       *   - grid size:
+       *       const int Width, Height;
+       *   - number of octaves:
+       *       const int Octaves;
+       *   - result array (Width * Height values, row by row):
+       *       Type *Out;
+       * RETURNS: None.
+       */
+      template<int N = 8>
+        void FillTurb2D( const vec2<Type> &Origin, const vec2<Type> &Step, const int Width, const int Height,
+                         const int Octaves, Type *Out ) const
+        {
+          if (Width <= 0)
+            return;
+          parallel::For(0, Height,
+            [&]( const int Begin, const int End, const int )
+            {
+              const simd<Type, N> Column = simd<Type, N>::Index() * simd<Type, N>(Step.X);
+
+              for (int r = Begin; r < End; r++)
+              {
+                const simd<Type, N> Y(Origin.Y + Step.Y * r);
+                Type *Row = Out + static_cast<long long>(r) * Width;
+
+                for (int c = 0; c < Width; c += N)
+                {
+                  const simd<Type, N> V = NoiseTurb2D(simd<Type, N>(Origin.X + Step.X * c) + Column, Y, Octaves);
+
+                  if (Width - c >= N)
+                    V.Store(Row + c);
+                  else
+                    for (int l = 0; l < Width - c; l++)
+                      Row[c + l] = V[l];
+                }
+              }
+            }, PARALLEL_MIN / Width + 1);
+        } /* End of 'FillTurb2D' function */
+
     }; /* End of 'noise' class */
+
+  /* Compact hash noise class.
+   * Lattice values are taken from 512 byte permutation table (256 permutation
+   * repeated twice to avoid index masking between hash levels) instead of
+   * TAB_SIZE^2 values table, so whole state fits in few cache lines.
+   * Value noise has same lattice period (256), range [0, 1] and mean as 'noise'.
+   * Same permutation hashes lattice gradients of improved Perlin and simplex
+   * noise in 2D - 4D (range [-1, 1], lane generic, batched by 'simd' lanes).
+   */
+  template<typename Type>
+    class hash_noise
+    {
+      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in hash_noise");
+
+    public:
+      static const int TAB_BITS = 8;
+      static const int TAB_SIZE = 1 << TAB_BITS;
+      static const int TAB_MASK = TAB_SIZE - 1;
+
+      static constexpr Type NOISE_MEAN = static_cast<Type>(0.5); // Noise mean value
+      static constexpr UINT DEFAULT_SEED = 30102;                   // Permutation seed used by default constructor
+      static const int PARALLEL_MIN = 4096;                         // Minimal samples count per thread in batch evaluation
+
+      /* Gradient noise basis functions */
+      enum struct basis
+      {
+        PERLIN, // Improved Perlin noise (quintic fade, lattice gradients)
+        SIMPLEX // Simplex noise (radial kernels on simplex corners)
+      }; /* End of 'basis' enumeration */
+
+      BYTE Perm[TAB_SIZE * 2]; // Permutation table (repeated twice)
+
+    private:
+      /* Floor to integer function.
+       * ARGUMENTS:
+       *   - number to floor:
+       *       const Type X;
+       * RETURNS:
+       *   (int) greatest integer not above X.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static int FloorInt( const Type X ) noexcept
+      {
+        const int I = static_cast<int>(X);
+
+        return I > X ? I - 1 : I;
+      } /* End of 'FloorInt' function */
+
+      /* Smoothstep interpolation weight function.
+       * ARGUMENTS:
+       *   - fractional part of coordinate:
+       *       const Type F;
+       * RETURNS:
+       *   (Type) interpolation weight.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static Type Fade( const Type F ) noexcept
+      {
+        return (3 - 2 * F) * F * F;
+      } /* End of 'Fade' function */
+
+      /* Lattice value by hash function.
+       * ARGUMENTS:
+       *   - lattice hash:
+       *       const int H;
+       * RETURNS:
+       *   (Type) value in [0, 1].
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static Type Value( const int H ) noexcept
+      {
+        return static_cast<Type>(H) * static_cast<Type>(1.0 / TAB_MASK);
+      } /* End of 'Value' function */
+
+      /* Octave coordinates shifts (decorrelate octaves at lattice points) */
+      static constexpr Type OCTAVE_SHIFT[4] =
+      {
+        static_cast<Type>(29.47), static_cast<Type>(18.102), static_cast<Type>(7.331), static_cast<Type>(11.57)
+      };
+
+      /* Vector type components count */
+      template<typename VecType>
+        static constexpr int DIMENSION =
+          std::is_same_v<VecType, vec2<Type>> ? 2 : std::is_same_v<VecType, vec3<Type>> ? 3 : std::is_same_v<VecType, vec4<Type>> ? 4 : 0;
+
+      /* Quintic fade curve function.
+       * ARGUMENTS:
+       *   - fractional part of coordinate lanes:
+       *       const Lane &T;
+       * RETURNS:
+       *   (Lane) interpolation weight with zero first and second derivatives at ends.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr static Lane Quintic( const Lane &T ) noexcept
+        {
+          return T * T * T * (T * (T * Lane(6) - Lane(15)) + Lane(10));
+        } /* End of 'Quintic' function */
+
+      /* Linear interpolation function.
+       * ARGUMENTS:
+       *   - values to interpolate:
+       *       const Lane &A, &B;
+       *   - interpolation weight:
+       *       const Lane &T;
+       * RETURNS:
+       *   (Lane) interpolated value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr static Lane Lerp( const Lane &A, const Lane &B, const Lane &T ) noexcept
+        {
+          return A + (B - A) * T;
+        } /* End of 'Lerp' function */
+
+      /* Permutation lookup function.
+       * ARGUMENTS:
+       *   - table index (in [0, 2 * TAB_SIZE)):
+       *       const int I;
+       * RETURNS:
+       *   (int) permuted value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr int Permute( const int I ) const noexcept
+      {
+        return Perm[I];
+      } /* End of 'Permute' function */
+
+      /* Permutation lookup for N lanes (gather) function.
+       * ARGUMENTS:
+       *   - table indices (in [0, 2 * TAB_SIZE)):
+       *       const simd<int, N> &I;
+       * RETURNS:
+       *   (simd<int, N>) permuted values.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<int N>
+        constexpr simd<int, N> Permute( const simd<int, N> &I ) const noexcept
+        {
+          return Gather(Perm, I);
+        } /* End of 'Permute' function */
+
+      /* 2D gradient dot product function (8 gradients (1, 2) like).
+       * ARGUMENTS:
+       *   - lattice hash lanes:
+       *       const ILane &Hash;
+       *   - offset from lattice point lanes:
+       *       const Lane &X, &Y;
+       * RETURNS:
+       *   (Lane) gradient by offset dot product.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename ILane>
+        constexpr static Lane Grad( const ILane &Hash, const Lane &X, const Lane &Y ) noexcept
+        {
+          const ILane H = Hash & ILane(7);
+          const Lane
+            U = Select(H < ILane(4), X, Y),
+            V = Select(H < ILane(4), Y, X) * Lane(2);
+
+          return Select((H & ILane(1)) != ILane(0), -U, U) + Select((H & ILane(2)) != ILane(0), -V, V);
+        } /* End of 'Grad' function */
+
+      /* 3D gradient dot product function (12 cube edges gradients).
+       * ARGUMENTS:
+       *   - lattice hash lanes:
+       *       const ILane &Hash;
+       *   - offset from lattice point lanes:
+       *       const Lane &X, &Y, &Z;
+       * RETURNS:
+       *   (Lane) gradient by offset dot product.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename ILane>
+        constexpr static Lane Grad( const ILane &Hash, const Lane &X, const Lane &Y, const Lane &Z ) noexcept
+        {
+          const ILane H = Hash & ILane(15);
+          const Lane
+            U = Select(H < ILane(8), X, Y),
+            V = Select(H < ILane(4), Y, Select((H == ILane(12)) | (H == ILane(14)), X, Z));
+
+          return Select((H & ILane(1)) != ILane(0), -U, U) + Select((H & ILane(2)) != ILane(0), -V, V);
+        } /* End of 'Grad' function */
+
+      /* 4D gradient dot product function (32 tesseract edges gradients).
+       * ARGUMENTS:
+       *   - lattice hash lanes:
+       *       const ILane &Hash;
+       *   - offset from lattice point lanes:
+       *       const Lane &X, &Y, &Z, &W;
+       * RETURNS:
+       *   (Lane) gradient by offset dot product.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename ILane>
+        constexpr static Lane Grad( const ILane &Hash, const Lane &X, const Lane &Y, const Lane &Z, const Lane &W ) noexcept
+        {
+          const ILane H = Hash & ILane(31);
+          const Lane
+            U = Select(H < ILane(24), X, Y),
+            V = Select(H < ILane(16), Y, Z),
+            T = Select(H < ILane(8), Z, W);
+
+          return
+            Select((H & ILane(1)) != ILane(0), -U, U) +
+            Select((H & ILane(2)) != ILane(0), -V, V) +
+            Select((H & ILane(4)) != ILane(0), -T, T);
+        } /* End of 'Grad' function */
+
+      /* Simplex corner contribution function.
+       * ARGUMENTS:
+       *   - kernel radius square:
+       *       const Type R2;
+       *   - squared distance to corner lanes:
+       *       const Lane &Dist2;
+       *   - gradient by offset dot product lanes:
+       *       const Lane &G;
+       * RETURNS:
+       *   (Lane) (R2 - Dist2)^4 * G (0 outside kernel).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr static Lane Kernel( const Type R2, const Lane &Dist2, const Lane &G ) noexcept
+        {
+          const Lane T = Max(Lane(R2) - Dist2, Lane(0)), T2 = T * T;
+
+          return T2 * T2 * G;
+        } /* End of 'Kernel' function */
+
+      /* Evaluate gradient noise basis function.
+       * ARGUMENTS:
+       *   - basis function:
+       *       const basis B;
+       *   - point coordinates lanes:
+       *       const Lane (&P)[D];
+       * RETURNS:
+       *   (Lane) noise value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, int D>
+        constexpr Lane Basis( const basis B, const Lane (&P)[D] ) const noexcept
+        {
+          static_assert(D >= 2 && D <= 4, "2D, 3D or 4D vector is needed in hash_noise");
+
+          if constexpr (D == 2)
+            return B == basis::SIMPLEX ? Simplex2D(P[0], P[1]) : Perlin2D(P[0], P[1]);
+          else if constexpr (D == 3)
+            return B == basis::SIMPLEX ? Simplex3D(P[0], P[1], P[2]) : Perlin3D(P[0], P[1], P[2]);
+          else
+            return B == basis::SIMPLEX ? Simplex4D(P[0], P[1], P[2], P[3]) : Perlin4D(P[0], P[1], P[2], P[3]);
+        } /* End of 'Basis' function */
+
+      /* Fractal sum of gradient noise octaves function.
+       * ARGUMENTS:
+       *   - basis function:
+       *       const basis B;
+       *   - point coordinates lanes:
+       *       const Lane (&P)[D];
+       *   - number of octaves:
+       *       const int Octaves;
+       *   - frequency and amplitude factors between octaves:
+       *       const Type Lacunarity, Gain;
+       *   - turbulence (sum of absolute values) flag:
+       *       const bool IsTurb;
+       * RETURNS:
+       *   (Lane) sum normalized by amplitudes sum.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, int D>
+        constexpr Lane Fractal( const basis B, const Lane (&P)[D], const int Octaves, const Type Lacunarity, const Type Gain, const bool IsTurb ) const noexcept
+        {
+          Lane Sum(0), Q[D];
+          Type Amp = 1, Freq = 1, Norm = 0;
+
+          for (int i = 0; i < Octaves; i++)
+          {
+            for (int c = 0; c < D; c++)
+              Q[c] = P[c] * Lane(Freq) + Lane(OCTAVE_SHIFT[c] * i);
+
+            const Lane V = Basis(B, Q);
+
+            Sum += (IsTurb ? Abs(V) : V) * Lane(Amp);
+            Norm += Amp;
+            Amp *= Gain;
+            Freq *= Lacunarity;
+          }
+          return Norm > 0 ? Sum * Lane(1 / Norm) : Sum;
+        } /* End of 'Fractal' function */
+
+      /* Fractal sum for points array function.
+       * Points are processed by N lanes packs in parallel threads.
+       * ARGUMENTS:
+       *   - points array:
+       *       const VecType *P;
+       *   - result values array:
+       *       Type *Out;
+       *   - number of points:
+       *       const int Num;
+       *   - number of octaves:
+       *       const int Octaves;
+       *   - basis function:
+       *       const basis B;
+       *   - frequency and amplitude factors between octaves:
+       *       const Type Lacunarity, Gain;
+       *   - turbulence (sum of absolute values) flag:
+       *       const bool IsTurb;
+       * RETURNS: None.
+       */
+      template<int N, typename VecType>
+        void FractalBatch( const VecType *P, Type *Out, const int Num, const int Octaves, const basis B,
+                           const Type Lacunarity, const Type Gain, const bool IsTurb ) const
+        {
+          constexpr int D = DIMENSION<VecType>;
+
+          parallel::For(0, (Num + N - 1) / N,
+            [&]( const int Begin, const int End, const int )
+            {
+              for (int b = Begin; b < End; b++)
+              {
+                const int
+                  First = b * N,
+                  Size = Num - First < N ? Num - First : N;
+                simd<Type, N> C[D];
+
+                for (int c = 0; c < D; c++)
+                  for (int l = 0; l < N; l++)
+                    C[c].V[l] = l < Size ? P[First + l][c] : 0;
+
+                const simd<Type, N> V = Fractal(B, C, Octaves, Lacunarity, Gain, IsTurb);
+
+                for (int l = 0; l < Size; l++)
+                  Out[First + l] = V.V[l];
+              }
+            }, PARALLEL_MIN / N);
+        } /* End of 'FractalBatch' function */
+
+    public:
+      /* Class default constructor.
+       * ARGUMENTS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr hash_noise( void ) noexcept : hash_noise(DEFAULT_SEED)
+      {
+      } /* End of 'hash_noise' function */
+
+      /* Class constructor by permutation seed.
+       * Permutation is shuffled by 'random::pcg' sequence (can be built at compile time).
+       * ARGUMENTS:
+       *   - permutation seed:
+       *       const UINT Seed;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      explicit constexpr hash_noise( const UINT Seed ) noexcept
+      {
+        random::pcg Rnd(Seed);
+
+        for (int i = 0; i < TAB_SIZE; i++)
+          Perm[i] = static_cast<BYTE>(i);
+        for (int i = TAB_SIZE - 1; i > 0; i--)
+        {
+          const int j = static_cast<int>(Rnd.Next() % static_cast<UINT>(i + 1));
+          const BYTE Tmp = Perm[i];
+
+          Perm[i] = Perm[j];
+          Perm[j] = Tmp;
+        }
+        for (int i = 0; i < TAB_SIZE; i++)
+          Perm[TAB_SIZE + i] = Perm[i];
+      } /* End of 'hash_noise' function */
+
+      /* Lattice point hash function.
+       * ARGUMENTS:
+       *   - lattice coordinates (masked by TAB_MASK):
+       *       const int X, Y, Z;
+       * RETURNS:
+       *   (int) hash in [0, TAB_MASK].
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr int Hash( const int X, const int Y = 0, const int Z = 0 ) const noexcept
+      {
+        return Perm[Perm[Perm[X] + Y] + Z];
+      } /* End of 'Hash' function */
+
+      /* Get 1D noise function.
+       * ARGUMENTS:
+       *   - noise argument:
+       *       const Type X;
+       * RETURNS:
+       *   (Type) noise value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Noise1D( const Type X ) const noexcept
+      {
+        const int ix = FloorInt(X);
+        const Type fx = Fade(X - ix);
+        const int x0 = ix & TAB_MASK, x1 = (x0 + 1) & TAB_MASK;
+        const Type v0 = Value(Perm[x0]), v1 = Value(Perm[x1]);
+
+        return v0 + (v1 - v0) * fx;
+      } /* End of 'Noise1D' function */
+
+      /* Get 2D noise function.
+       * ARGUMENTS:
+       *   - noise arguments:
+       *       const Type X, Y;
+       * RETURNS:
+       *   (Type) noise value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Noise2D( const Type X, const Type Y ) const noexcept
+      {
+        const int ix = FloorInt(X), iy = FloorInt(Y);
+        const Type fx = Fade(X - ix), fy = Fade(Y - iy);
+        const int
+          x0 = ix & TAB_MASK, y0 = iy & TAB_MASK,
+          h0 = Perm[x0], h1 = Perm[x0 + 1];
+        const Type
+          v00 = Value(Perm[h0 + y0]), v01 = Value(Perm[h0 + y0 + 1]),
+          v10 = Value(Perm[h1 + y0]), v11 = Value(Perm[h1 + y0 + 1]),
+          v0 = v00 + (v01 - v00) * fy,
+          v1 = v10 + (v11 - v10) * fy;
+
+        return v0 + (v1 - v0) * fx;
+      } /* End of 'Noise2D' function */
+
+      /* Get 3D noise function.
+       * ARGUMENTS:
+       *   - noise arguments:
+       *       const Type X, Y, Z;
+       * RETURNS:
+       *   (Type) noise value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Noise3D( const Type X, const Type Y, const Type Z ) const noexcept
+      {
+        const int ix = FloorInt(X), iy = FloorInt(Y), iz = FloorInt(Z);
+        const Type fx = Fade(X - ix), fy = Fade(Y - iy), fz = Fade(Z - iz);
+        const int
+          x0 = ix & TAB_MASK, y0 = iy & TAB_MASK, z0 = iz & TAB_MASK,
+          h0 = Perm[x0], h1 = Perm[x0 + 1],
+          h00 = Perm[h0 + y0] + z0, h01 = Perm[h0 + y0 + 1] + z0,
+          h10 = Perm[h1 + y0] + z0, h11 = Perm[h1 + y0 + 1] + z0;
+        const Type
+          v000 = Value(Perm[h00]), v001 = Value(Perm[h00 + 1]),
+          v010 = Value(Perm[h01]), v011 = Value(Perm[h01 + 1]),
+          v100 = Value(Perm[h10]), v101 = Value(Perm[h10 + 1]),
+          v110 = Value(Perm[h11]), v111 = Value(Perm[h11 + 1]),
+          v00 = v000 + (v001 - v000) * fz, v01 = v010 + (v011 - v010) * fz,
+          v10 = v100 + (v101 - v100) * fz, v11 = v110 + (v111 - v110) * fz,
+          v0 = v00 + (v01 - v00) * fy,
+          v1 = v10 + (v11 - v10) * fy;
+
+        return v0 + (v1 - v0) * fx;
+      } /* End of 'Noise3D' function */
+
+      /* Noise 1D turb with level-of-detail function.
+       * ARGUMENTS:
+       *   - noise argument:
+       *       const Type X;
+       *   - maximal number of octaves:
+       *       const int Octaves;
+       *   - sample footprint in noise space (0 - no filtering):
+       *       const Type Footprint = 0;
+       * RETURNS:
+       *   (Type) turbulence value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type NoiseTurb1D( const Type X, const int Octaves, const Type Footprint = 0 ) const noexcept
+      {
+        const Type Lod = noise<Type>::OctavesLod(Octaves, Footprint);
+        Type val = 0, x = X, frac = 1;
+
+        for (int i = 0; i < Octaves; i++)
+        {
+          const Type W = Lod >= i + 1 ? 1 : Lod <= i ? 0 : Lod - i;
+
+          val += (W == 0 ? NOISE_MEAN : W == 1 ? Noise1D(x) : NOISE_MEAN + (Noise1D(x) - NOISE_MEAN) * W) / frac;
+          x = (x + static_cast<Type>(29.47)) * 2;
+          frac *= 2;
+        }
+        return val * (1 << (Octaves - 1)) / ((1 << Octaves) - 1);
+      } /* End of 'NoiseTurb1D' function */
+
+      /* Noise 2D turb with level-of-detail function.
+       * ARGUMENTS:
+       *   - noise arguments:
+       *       const Type X, Y;
+       *   - maximal number of octaves:
+       *       const int Octaves;
+       *   - sample footprint in noise space (0 - no filtering):
+       *       const Type Footprint = 0;
+       * RETURNS:
+       *   (Type) turbulence value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type NoiseTurb2D( const Type X, const Type Y, const int Octaves, const Type Footprint = 0 ) const noexcept
+      {
+        const Type Lod = noise<Type>::OctavesLod(Octaves, Footprint);
+        Type val = 0, x = X, y = Y, frac = 1;
+
+        for (int i = 0; i < Octaves; i++)
+        {
+          const Type W = Lod >= i + 1 ? 1 : Lod <= i ? 0 : Lod - i;
+
+          val += (W == 0 ? NOISE_MEAN : W == 1 ? Noise2D(x, y) : NOISE_MEAN + (Noise2D(x, y) - NOISE_MEAN) * W) / frac;
+          x = (x + static_cast<Type>(29.47)) * 2;
+          y = (y + static_cast<Type>(18.102)) * 2;
+          frac *= 2;
+        }
+        return val * (1 << (Octaves - 1)) / ((1 << Octaves) - 1);
+      } /* End of 'NoiseTurb2D' function */
+
+      /* Noise 3D turb with level-of-detail function.
+       * ARGUMENTS:
+       *   - noise arguments:
+       *       const Type X, Y, Z;
+       *   - maximal number of octaves:
+       *       const int Octaves;
+       *   - sample footprint in noise space (0 - no filtering):
+       *       const Type Footprint = 0;
+       * RETURNS:
+       *   (Type) turbulence value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type NoiseTurb3D( const Type X, const Type Y, const Type Z, const int Octaves, const Type Footprint = 0 ) const noexcept
+      {
+        const Type Lod = noise<Type>::OctavesLod(Octaves, Footprint);
+        Type val = 0, x = X, y = Y, z = Z, frac = 1;
+
+        for (int i = 0; i < Octaves; i++)
+        {
+          const Type W = Lod >= i + 1 ? 1 : Lod <= i ? 0 : Lod - i;
+
+          val += (W == 0 ? NOISE_MEAN : W == 1 ? Noise3D(x, y, z) : NOISE_MEAN + (Noise3D(x, y, z) - NOISE_MEAN) * W) / frac;
+          x = (x + static_cast<Type>(29.47)) * 2;
+          y = (y + static_cast<Type>(18.102)) * 2;
+          z = (z + static_cast<Type>(7.331)) * 2;
+          frac *= 2;
+        }
+        return val * (1 << (Octaves - 1)) / ((1 << Octaves) - 1);
+      } /* End of 'NoiseTurb3D' function */
+
+      /* Improved Perlin 2D noise function.
+       * Lane generic: Lane is Type or 'simd<Type, N>'. Lanes give scalar results unless
+       * compiler contracts multiply-adds (FMA) differently for them, then results differ
+       * by up to about 32 * epsilon(Type) * (1 + max |coordinate|) (1e-3 for FLT and
+       * coordinates within 300, typically 4 times less).
+       * ARGUMENTS:
+       *   - noise arguments lanes:
+       *       const Lane &X, &Y;
+       * RETURNS:
+       *   (Lane) noise value in [-1, 1] with zero mean (0 at lattice points).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr Lane Perlin2D( const Lane &X, const Lane &Y ) const noexcept
+        {
+          using ILane = simd_int<Lane>;
+          const Lane
+            FloorX = Floor(X), FloorY = Floor(Y),
+            x = X - FloorX, y = Y - FloorY,
+            u = Quintic(x), v = Quintic(y),
+            One(1);
+          const ILane
+            I = ILane(FloorX) & ILane(TAB_MASK),
+            J = ILane(FloorY) & ILane(TAB_MASK),
+            A = Permute(I) + J,
+            B = Permute(I + ILane(1)) + J;
+          const Lane
+            N00 = Grad(Permute(A), x, y),
+            N10 = Grad(Permute(B), x - One, y),
+            N01 = Grad(Permute(A + ILane(1)), x, y - One),
+            N11 = Grad(Permute(B + ILane(1)), x - One, y - One);
+
+          return Lerp(Lerp(N00, N10, u), Lerp(N01, N11, u), v) * Lane(static_cast<Type>(0.507));
+        } /* End of 'Perlin2D' function */
+
+      /* Improved Perlin 3D noise function (Perlin 2002).
+       * Lane generic: Lane is Type or 'simd<Type, N>'. Lanes give scalar results unless
+       * compiler contracts multiply-adds (FMA) differently for them, then results differ
+       * by up to about 32 * epsilon(Type) * (1 + max |coordinate|) (1e-3 for FLT and
+       * coordinates within 300, typically 4 times less).
+       * ARGUMENTS:
+       *   - noise arguments lanes:
+       *       const Lane &X, &Y, &Z;
+       * RETURNS:
+       *   (Lane) noise value in [-1, 1] with zero mean (0 at lattice points).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr Lane Perlin3D( const Lane &X, const Lane &Y, const Lane &Z ) const noexcept
+        {
+          using ILane = simd_int<Lane>;
+          const Lane
+            FloorX = Floor(X), FloorY = Floor(Y), FloorZ = Floor(Z),
+            x = X - FloorX, y = Y - FloorY, z = Z - FloorZ,
+            u = Quintic(x), v = Quintic(y), w = Quintic(z),
+            One(1);
+          const ILane
+            I = ILane(FloorX) & ILane(TAB_MASK),
+            J = ILane(FloorY) & ILane(TAB_MASK),
+            K = ILane(FloorZ) & ILane(TAB_MASK),
+            A = Permute(I) + J, AA = Permute(A) + K, AB = Permute(A + ILane(1)) + K,
+            B = Permute(I + ILane(1)) + J, BA = Permute(B) + K, BB = Permute(B + ILane(1)) + K;
+          const Lane
+            N000 = Grad(Permute(AA), x, y, z),
+            N100 = Grad(Permute(BA), x - One, y, z),
+            N010 = Grad(Permute(AB), x, y - One, z),
+            N110 = Grad(Permute(BB), x - One, y - One, z),
+            N001 = Grad(Permute(AA + ILane(1)), x, y, z - One),
+            N101 = Grad(Permute(BA + ILane(1)), x - One, y, z - One),
+            N011 = Grad(Permute(AB + ILane(1)), x, y - One, z - One),
+            N111 = Grad(Permute(BB + ILane(1)), x - One, y - One, z - One);
+
+          return Lerp(Lerp(Lerp(N000, N100, u), Lerp(N010, N110, u), v),
+                      Lerp(Lerp(N001, N101, u), Lerp(N011, N111, u), v), w) * Lane(static_cast<Type>(0.936));
+        } /* End of 'Perlin3D' function */
+
+      /* Improved Perlin 4D noise function.
+       * Lane generic: Lane is Type or 'simd<Type, N>'. Lanes give scalar results unless
+       * compiler contracts multiply-adds (FMA) differently for them, then results differ
+       * by up to about 32 * epsilon(Type) * (1 + max |coordinate|) (1e-3 for FLT and
+       * coordinates within 300, typically 4 times less).
+       * ARGUMENTS:
+       *   - noise arguments lanes:
+       *       const Lane &X, &Y, &Z, &W;
+       * RETURNS:
+       *   (Lane) noise value in [-1, 1] with zero mean (0 at lattice points).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr Lane Perlin4D( const Lane &X, const Lane &Y, const Lane &Z, const Lane &W ) const noexcept
+        {
+          using ILane = simd_int<Lane>;
+          const Lane
+            FloorP[4] = {Floor(X), Floor(Y), Floor(Z), Floor(W)},
+            F[4] = {X - FloorP[0], Y - FloorP[1], Z - FloorP[2], W - FloorP[3]},
+            One(1);
+          ILane H[16];
+          Lane N[16];
+
+          /* Hash corners level by level: H[Index] for corner bits (x, y, z, w) from high to low */
+          H[0] = ILane(FloorP[0]) & ILane(TAB_MASK);
+          for (int d = 1, Count = 1; d <= 4; d++, Count *= 2)
+            for (int c = Count - 1; c >= 0; c--)
+            {
+              const ILane Next = d < 4 ? ILane(FloorP[d]) & ILane(TAB_MASK) : ILane(0);
+
+              H[c * 2 + 1] = Permute(H[c] + ILane(1)) + Next;
+              H[c * 2] = Permute(H[c]) + Next;
+            }
+          for (int c = 0; c < 16; c++)
+            N[c] = Grad(H[c],
+              (c & 8) ? F[0] - One : F[0], (c & 4) ? F[1] - One : F[1],
+              (c & 2) ? F[2] - One : F[2], (c & 1) ? F[3] - One : F[3]);
+
+          /* Interpolate from last axis to first */
+          for (int d = 3, Count = 8; d >= 0; d--, Count /= 2)
+          {
+            const Lane T = Quintic(F[d]);
+
+            for (int c = 0; c < Count; c++)
+              N[c] = Lerp(N[c * 2], N[c * 2 + 1], T);
+          }
+          return N[0] * Lane(static_cast<Type>(0.87));
+        } /* End of 'Perlin4D' function */
+
+      /* Simplex 2D noise function.
+       * Lane generic: Lane is Type or 'simd<Type, N>'. Lanes give scalar results unless
+       * compiler contracts multiply-adds (FMA) differently for them, then results differ
+       * by up to about 32 * epsilon(Type) * (1 + max |coordinate|) (1e-3 for FLT and
+       * coordinates within 300, typically 4 times less).
+       * ARGUMENTS:
+       *   - noise arguments lanes:
+       *       const Lane &X, &Y;
+       * RETURNS:
+       *   (Lane) noise value in [-1, 1] with zero mean.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr Lane Simplex2D( const Lane &X, const Lane &Y ) const noexcept
+        {
+          using ILane = simd_int<Lane>;
+          constexpr Type
+            F2 = static_cast<Type>(0.36602540378443864676), // (sqrt(3) - 1) / 2
+            G2 = static_cast<Type>(0.21132486540518711775); // (3 - sqrt(3)) / 6
+          const Lane
+            S = (X + Y) * Lane(F2),
+            Fi = Floor(X + S), Fj = Floor(Y + S),
+            T = (Fi + Fj) * Lane(G2),
+            X0 = X - (Fi - T), Y0 = Y - (Fj - T),
+            I1 = Select(X0 > Y0, Lane(1), Lane(0)), J1 = Lane(1) - I1,
+            X1 = X0 - I1 + Lane(G2), Y1 = Y0 - J1 + Lane(G2),
+            X2 = X0 - Lane(1 - 2 * G2), Y2 = Y0 - Lane(1 - 2 * G2);
+          const ILane
+            I = ILane(Fi) & ILane(TAB_MASK),
+            J = ILane(Fj) & ILane(TAB_MASK),
+            H0 = Permute(I + Permute(J)),
+            H1 = Permute(I + ILane(I1) + Permute(J + ILane(J1))),
+            H2 = Permute(I + ILane(1) + Permute(J + ILane(1)));
+
+          return (
+            Kernel(static_cast<Type>(0.5), X0 * X0 + Y0 * Y0, Grad(H0, X0, Y0)) +
+            Kernel(static_cast<Type>(0.5), X1 * X1 + Y1 * Y1, Grad(H1, X1, Y1)) +
+            Kernel(static_cast<Type>(0.5), X2 * X2 + Y2 * Y2, Grad(H2, X2, Y2))) * Lane(40);
+        } /* End of 'Simplex2D' function */
+
+      /* Simplex 3D noise function.
+       * Lane generic: Lane is Type or 'simd<Type, N>'. Lanes give scalar results unless
+       * compiler contracts multiply-adds (FMA) differently for them, then results differ
+       * by up to about 32 * epsilon(Type) * (1 + max |coordinate|) (1e-3 for FLT and
+       * coordinates within 300, typically 4 times less).
+       * ARGUMENTS:
+       *   - noise arguments lanes:
+       *       const Lane &X, &Y, &Z;
+       * RETURNS:
+       *   (Lane) noise value in [-1, 1] with zero mean.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr Lane Simplex3D( const Lane &X, const Lane &Y, const Lane &Z ) const noexcept
+        {
+          using ILane = simd_int<Lane>;
+          constexpr Type
+            F3 = static_cast<Type>(1.0 / 3),
+            G3 = static_cast<Type>(1.0 / 6);
+          const Lane
+            S = (X + Y + Z) * Lane(F3),
+            Fi = Floor(X + S), Fj = Floor(Y + S), Fk = Floor(Z + S),
+            T = (Fi + Fj + Fk) * Lane(G3),
+            X0 = X - (Fi - T), Y0 = Y - (Fj - T), Z0 = Z - (Fk - T),
+            Zero(0), One(1);
+          /* Simplex corners order by coordinates ranks (ties broken as X > Y > Z) */
+          const auto
+            XY = X0 >= Y0, XZ = X0 >= Z0, YZ = Y0 >= Z0,
+            YX = Y0 > X0, ZX = Z0 > X0, ZY = Z0 > Y0;
+          const Lane
+            I1 = Select(XY & XZ, One, Zero), I2 = Select(XY | XZ, One, Zero),
+            J1 = Select(YX & YZ, One, Zero), J2 = Select(YX | YZ, One, Zero),
+            K1 = Select(ZX & ZY, One, Zero), K2 = Select(ZX | ZY, One, Zero),
+            X1 = X0 - I1 + Lane(G3), Y1 = Y0 - J1 + Lane(G3), Z1 = Z0 - K1 + Lane(G3),
+            X2 = X0 - I2 + Lane(2 * G3), Y2 = Y0 - J2 + Lane(2 * G3), Z2 = Z0 - K2 + Lane(2 * G3),
+            X3 = X0 - Lane(1 - 3 * G3), Y3 = Y0 - Lane(1 - 3 * G3), Z3 = Z0 - Lane(1 - 3 * G3);
+          const ILane
+            I = ILane(Fi) & ILane(TAB_MASK),
+            J = ILane(Fj) & ILane(TAB_MASK),
+            K = ILane(Fk) & ILane(TAB_MASK),
+            H0 = Permute(I + Permute(J + Permute(K))),
+            H1 = Permute(I + ILane(I1) + Permute(J + ILane(J1) + Permute(K + ILane(K1)))),
+            H2 = Permute(I + ILane(I2) + Permute(J + ILane(J2) + Permute(K + ILane(K2)))),
+            H3 = Permute(I + ILane(1) + Permute(J + ILane(1) + Permute(K + ILane(1))));
+          constexpr Type R2 = static_cast<Type>(0.6);
+
+          return (
+            Kernel(R2, X0 * X0 + Y0 * Y0 + Z0 * Z0, Grad(H0, X0, Y0, Z0)) +
+            Kernel(R2, X1 * X1 + Y1 * Y1 + Z1 * Z1, Grad(H1, X1, Y1, Z1)) +
+            Kernel(R2, X2 * X2 + Y2 * Y2 + Z2 * Z2, Grad(H2, X2, Y2, Z2)) +
+            Kernel(R2, X3 * X3 + Y3 * Y3 + Z3 * Z3, Grad(H3, X3, Y3, Z3))) * Lane(32);
+        } /* End of 'Simplex3D' function */
+
+      /* Simplex 4D noise function.
+       * Lane generic: Lane is Type or 'simd<Type, N>'. Lanes give scalar results unless
+       * compiler contracts multiply-adds (FMA) differently for them, then results differ
+       * by up to about 32 * epsilon(Type) * (1 + max |coordinate|) (1e-3 for FLT and
+       * coordinates within 300, typically 4 times less).
+       * ARGUMENTS:
+       *   - noise arguments lanes:
+       *       const Lane &X, &Y, &Z, &W;
+       * RETURNS:
+       *   (Lane) noise value in [-1, 1] with zero mean.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr Lane Simplex4D( const Lane &X, const Lane &Y, const Lane &Z, const Lane &W ) const noexcept
+        {
+          using ILane = simd_int<Lane>;
+          constexpr Type
+            F4 = static_cast<Type>(0.30901699437494742410), // (sqrt(5) - 1) / 4
+            G4 = static_cast<Type>(0.13819660112501051518); // (5 - sqrt(5)) / 20
+          const Lane
+            S = (X + Y + Z + W) * Lane(F4),
+            Fl[4] = {Floor(X + S), Floor(Y + S), Floor(Z + S), Floor(W + S)},
+            T = (Fl[0] + Fl[1] + Fl[2] + Fl[3]) * Lane(G4),
+            P0[4] = {X - (Fl[0] - T), Y - (Fl[1] - T), Z - (Fl[2] - T), W - (Fl[3] - T)},
+            Zero(0), One(1);
+          Lane Rank[4] = {Zero, Zero, Zero, Zero}, Sum(0);
+          ILane L[4];
+
+          /* Coordinates ranks (number of smaller coordinates, ties broken by axis order) */
+          for (int a = 0; a < 4; a++)
+            for (int b = a + 1; b < 4; b++)
+            {
+              const auto IsGreater = P0[a] > P0[b];
+
+              Rank[a] += Select(IsGreater, One, Zero);
+              Rank[b] += Select(IsGreater, Zero, One);
+            }
+          for (int a = 0; a < 4; a++)
+            L[a] = ILane(Fl[a]) & ILane(TAB_MASK);
+
+          /* Corner c steps axes with rank >= 4 - c */
+          for (int c = 0; c < 5; c++)
+          {
+            Lane P[4], Dist2(0);
+            ILane H(0);
+
+            for (int a = 3; a >= 0; a--)
+            {
+              const Lane Step = c == 0 ? Zero : c == 4 ? One : Select(Rank[a] >= Lane(static_cast<Type>(4 - c)), One, Zero);
+
+              P[a] = P0[a] - Step + Lane(G4 * c);
+              Dist2 += P[a] * P[a];
+              H = Permute(L[a] + ILane(Step) + H);
+            }
+            Sum += Kernel(static_cast<Type>(0.6), Dist2, Grad(H, P[0], P[1], P[2], P[3]));
+          }
+          return Sum * Lane(27);
+        } /* End of 'Simplex4D' function */
+
+      /* Improved Perlin noise functions by vectors.
+       * ARGUMENTS:
+       *   - noise argument:
+       *       const vec2<Type> &P; (or vec3, vec4)
+       * RETURNS:
+       *   (Type) noise value in [-1, 1].
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Perlin( const vec2<Type> &P ) const noexcept
+      {
+        return Perlin2D(P.X, P.Y);
+      } /* End of 'Perlin' function */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Perlin( const vec3<Type> &P ) const noexcept
+      {
+        return Perlin3D(P.X, P.Y, P.Z);
+      } /* End of 'Perlin' function */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Perlin( const vec4<Type> &P ) const noexcept
+      {
+        return Perlin4D(P.X, P.Y, P.Z, P.W);
+      } /* End of 'Perlin' function */
+
+      /* Simplex noise functions by vectors.
+       * ARGUMENTS:
+       *   - noise argument:
+       *       const vec2<Type> &P; (or vec3, vec4)
+       * RETURNS:
+       *   (Type) noise value in [-1, 1].
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Simplex( const vec2<Type> &P ) const noexcept
+      {
+        return Simplex2D(P.X, P.Y);
+      } /* End of 'Simplex' function */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Simplex( const vec3<Type> &P ) const noexcept
+      {
+        return Simplex3D(P.X, P.Y, P.Z);
+      } /* End of 'Simplex' function */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Simplex( const vec4<Type> &P ) const noexcept
+      {
+        return Simplex4D(P.X, P.Y, P.Z, P.W);
+      } /* End of 'Simplex' function */
+
+      /* Fractal Brownian motion function.
+       * Octaves of gradient noise with frequency multiplied by Lacunarity
+       * and amplitude by Gain, sum is normalized by amplitudes sum.
+       * ARGUMENTS:
+       *   - noise argument (vec2, vec3 or vec4):
+       *       const VecType &P;
+       *   - number of octaves:
+       *       const int Octaves;
+       *   - basis function:
+       *       const basis B = basis::PERLIN;
+       *   - frequency and amplitude factors between octaves:
+       *       const Type Lacunarity = 2, Gain = 0.5;
+       * RETURNS:
+       *   (Type) noise value in [-1, 1].
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename VecType>
+        constexpr Type Fbm( const VecType &P, const int Octaves, const basis B = basis::PERLIN,
+                            const Type Lacunarity = 2, const Type Gain = static_cast<Type>(0.5) ) const noexcept
+        {
+          Type C[DIMENSION<VecType>];
+
+          for (int c = 0; c < DIMENSION<VecType>; c++)
+            C[c] = P[c];
+          return Fractal(B, C, Octaves, Lacunarity, Gain, false);
+        } /* End of 'Fbm' function */
+
+      /* Turbulence (fractal sum of absolute values) function.
+       * ARGUMENTS:
+       *   - noise argument (vec2, vec3 or vec4):
+       *       const VecType &P;
+       *   - number of octaves:
+       *       const int Octaves;
+       *   - basis function:
+       *       const basis B = basis::PERLIN;
+       *   - frequency and amplitude factors between octaves:
+       *       const Type Lacunarity = 2, Gain = 0.5;
+       * RETURNS:
+       *   (Type) noise value in [0, 1].
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename VecType>
+        constexpr Type Turbulence( const VecType &P, const int Octaves, const basis B = basis::PERLIN,
+                                   const Type Lacunarity = 2, const Type Gain = static_cast<Type>(0.5) ) const noexcept
+        {
+          Type C[DIMENSION<VecType>];
+
+          for (int c = 0; c < DIMENSION<VecType>; c++)
+            C[c] = P[c];
+          return Fractal(B, C, Octaves, Lacunarity, Gain, true);
+        } /* End of 'Turbulence' function */
+
+      /* Fractal Brownian motion for points array function.
+       * Points are processed by N lanes packs in parallel threads,
+       * results are same as scalar 'Fbm' up to multiply-adds contraction (see 'Perlin2D'):
+       * with default factors difference is below Octaves * 32 * epsilon(Type) * (1 + max |coordinate|)
+       * (single octave gives plain noise).
+       * ARGUMENTS:
+       *   - points array (vec2, vec3 or vec4):
+       *       const VecType *P;
+       *   - result values array:
+       *       Type *Out;
+       *   - number of points:
+       *       const int Num;
+       *   - number of octaves:
+       *       const int Octaves;
+       *   - basis function:
+       *       const basis B = basis::PERLIN;
+       *   - frequency and amplitude factors between octaves:
+       *       const Type Lacunarity = 2, Gain = 0.5;
+       * RETURNS: None.
+       */
+      template<int N = 8, typename VecType>
+        void Fbm( const VecType *P, Type *Out, const int Num, const int Octaves, const basis B = basis::PERLIN,
+                  const Type Lacunarity = 2, const Type Gain = static_cast<Type>(0.5) ) const
+        {
+          FractalBatch<N>(P, Out, Num, Octaves, B, Lacunarity, Gain, false);
+        } /* End of 'Fbm' function */
+
+      /* Turbulence for points array function (see 'Fbm').
+       * ARGUMENTS:
+       *   - points array (vec2, vec3 or vec4):
+       *       const VecType *P;
+       *   - result values array:
+       *       Type *Out;
+       *   - number of points:
+       *       const int Num;
+       *   - number of octaves:
+       *       const int Octaves;
+       *   - basis function:
+       *       const basis B = basis::PERLIN;
+       *   - frequency and amplitude factors between octaves:
+       *       const Type Lacunarity = 2, Gain = 0.5;
+       * RETURNS: None.
+       */
+      template<int N = 8, typename VecType>
+        void Turbulence( const VecType *P, Type *Out, const int Num, const int Octaves, const basis B = basis::PERLIN,
+                         const Type Lacunarity = 2, const Type Gain = static_cast<Type>(0.5) ) const
+        {
+          FractalBatch<N>(P, Out, Num, Octaves, B, Lacunarity, Gain, true);
+        } /* End of 'Turbulence' function */
+
+    }; /* End of 'hash_noise' class */
 } /* end of 'mth' namespace */
 
 #endif /* __mth_noise_h_ */
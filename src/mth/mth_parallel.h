@@ -0,0 +1,108 @@
+/***************************************************************
+ * FILE NAME   : mth_parallel.h
+ * PURPOSE     : Parallel execution support module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_parallel_h_
+#define __mth_parallel_h_
+
+#include <thread>
+#include <vector>
+
+#include "mth_def.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Parallel execution namespace (host only) */
+  namespace parallel
+  {
+    /* Get number of worker threads function.
+     * ARGUMENTS: None.
+     * RETURNS:
+     *   (int) number of hardware threads (at least 1).
+     */
+    inline int ThreadsCount( void ) noexcept
+    {
+      static const int Count = static_cast<int>(std::thread::hardware_concurrency());
+
+      return Count > 0 ? Count : 1;
+    } /* End of 'ThreadsCount' function */
+
+    /* Parallel range processing function.
+     * Range is split to contiguous chunks (one per thread), caller thread
+     * processes last chunk. Small ranges are processed in caller thread.
+     * ARGUMENTS:
+     *   - range to process:
+     *       const int Begin, End;
+     *   - chunk processing function (called as F(ChunkBegin, ChunkEnd, ChunkIndex)):
+     *       const Func &F;
+     *   - minimal chunk size:
+     *       const int MinChunk = 1;
+     *   - maximal number of threads (0 for all hardware threads):
+     *       const int MaxThreads = 0;
+     * RETURNS:
+     *   (int) number of used chunks.
+     */
+    template<typename Func>
+      inline int For( const int Begin, const int End, const Func &F, const int MinChunk = 1, const int MaxThreads = 0 )
+      {
+        const int
+          Count = End - Begin,
+          Threads = MaxThreads > 0 && MaxThreads < ThreadsCount() ? MaxThreads : ThreadsCount();
+        int Chunks = Count / (MinChunk > 0 ? MinChunk : 1);
+
+        if (Chunks > Threads)
+          Chunks = Threads;
+        if (Chunks <= 1)
+        {
+          if (Count > 0)
+            F(Begin, End, 0);
+          return 1;
+        }
+
+        std::vector<std::thread> Workers;
+
+        Workers.reserve(Chunks - 1);
+        for (int i = 0; i < Chunks - 1; i++)
+          Workers.emplace_back(F, Begin + static_cast<int>(static_cast<long long>(Count) * i / Chunks),
+                                  Begin + static_cast<int>(static_cast<long long>(Count) * (i + 1) / Chunks), i);
+        F(Begin + static_cast<int>(static_cast<long long>(Count) * (Chunks - 1) / Chunks), End, Chunks - 1);
+        for (auto &W : Workers)
+          W.join();
+        return Chunks;
+      } /* End of 'For' function */
+
+    /* Run two tasks in parallel function.
+     * ARGUMENTS:
+     *   - first task (run in new thread if 'IsParallel'):
+     *       const Func1 &F1;
+     *   - second task (run in caller thread):
+     *       const Func2 &F2;
+     *   - run in parallel flag:
+     *       const bool IsParallel = true;
+     * RETURNS: None.
+     */
+    template<typename Func1, typename Func2>
+      inline void Invoke( const Func1 &F1, const Func2 &F2, const bool IsParallel = true )
+      {
+        if (!IsParallel || ThreadsCount() == 1)
+        {
+          F1();
+          F2();
+          return;
+        }
+
+        std::thread Worker(F1);
+
+        F2();
+        Worker.join();
+      } /* End of 'Invoke' function */
+
+  } /* end of 'parallel' namespace */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_parallel_h_ */
+
+/* END OF 'mth_parallel.h' FILE */
@@ -0,0 +1,441 @@
+/***************************************************************
+ * FILE NAME   : mth_poly.h
+ * PURPOSE     : Fixed degree polynomial class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_poly_h_
+#define __mth_poly_h_
+
+#include <limits>
+
+#include "mth_def.h"
+#include "mth_simd.h"
+#include "mth_parallel.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Fixed degree polynomial class.
+   * Degree is template argument, so all coefficient loops have compile
+   * time bounds and are unrolled. Real roots in interval are isolated by
+   * Sturm sequence bisection and refined by bracketed Newton iterations.
+   */
+  template<int N, typename Type = DBL>
+    class poly
+    {
+      static_assert(number<Type>, "Number type is needed in poly");
+      static_assert(N >= 0, "Non negative degree is needed in poly");
+
+    public:
+      static const int DEGREE = N;
+      static const int MAX_DEPTH = 64;       // Maximal interval bisection depth
+      static const int MAX_NEWTON_ITER = 64; // Maximal bracketed Newton iterations
+
+      Type K[N + 1]; // Coefficients (K[I] for X^I)
+
+      /* Sturm sequence type */
+      struct sturm
+      {
+        Type S[N + 1][N + 1]; // Sequence polynomials coefficients
+        int Deg[N + 1];       // Sequence polynomials degrees
+        int Count;            // Sequence length
+
+        /* Count sequence sign changes function.
+         * ARGUMENTS:
+         *   - point:
+         *       const Type X;
+         * RETURNS:
+         *   (int) number of sign changes (zeros skipped).
+         */
+#ifdef __CUDA__
+        __host__ __device__
+#endif /* __CUDA__ */
+        constexpr int SignChanges( const Type X ) const noexcept
+        {
+          int Changes = 0, Prev = 0;
+
+          for (int i = 0; i < Count; i++)
+          {
+            Type V = S[i][Deg[i]];
+
+            for (int j = Deg[i] - 1; j >= 0; j--)
+              V = V * X + S[i][j];
+
+            const int Sign = static_cast<int>(V > 0) - static_cast<int>(V < 0);
+
+            if (Sign != 0)
+            {
+              Changes += Prev != 0 && Sign != Prev;
+              Prev = Sign;
+            }
+          }
+          return Changes;
+        } /* End of 'SignChanges' function */
+      }; /* End of 'sturm' structure */
+
+      /* Class default constructor */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr poly( void ) = default;
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - coefficients (from constant to highest power):
+       *       const Type (&Coeffs)[N + 1];
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr poly( const Type (&Coeffs)[N + 1] ) noexcept
+      {
+        for (int i = 0; i <= N; i++)
+          K[i] = Coeffs[i];
+      } /* End of 'poly' function */
+
+      /* Evaluate polynomial (Horner scheme) function.
+       * ARGUMENTS:
+       *   - argument (number or simd lanes):
+       *       const Lane &X;
+       * RETURNS:
+       *   (Lane) polynomial value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr Lane operator()( const Lane &X ) const noexcept
+        {
+          Lane V(K[N]);
+
+          for (int i = N - 1; i >= 0; i--)
+            V = V * X + Lane(K[i]);
+          return V;
+        } /* End of 'operator()' function */
+
+      /* Evaluate polynomial with derivative function.
+       * ARGUMENTS:
+       *   - argument:
+       *       const Type X;
+       *   - derivative value:
+       *       Type &D;
+       * RETURNS:
+       *   (Type) polynomial value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Eval( const Type X, Type &D ) const noexcept
+      {
+        Type V = K[N];
+
+        D = 0;
+        for (int i = N - 1; i >= 0; i--)
+        {
+          D = D * X + V;
+          V = V * X + K[i];
+        }
+        return V;
+      } /* End of 'Eval' function */
+
+      /* Get derivative polynomial function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (poly<N - 1, Type>) derivative (zero constant for degree 0).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr auto Derivative( void ) const noexcept
+      {
+        if constexpr (N == 0)
+          return poly<0, Type>({0});
+        else
+        {
+          poly<N - 1, Type> D;
+
+          for (int i = 1; i <= N; i++)
+            D.K[i - 1] = K[i] * i;
+          return D;
+        }
+      } /* End of 'Derivative' function */
+
+      /* Build Sturm sequence function.
+       * Every member is scaled to unit maximal coefficient, coefficients
+       * below relative epsilon are dropped from remainders.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (sturm) Sturm sequence.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sturm Sturm( void ) const noexcept
+      {
+        constexpr Type Eps = std::numeric_limits<Type>::epsilon() * 64;
+        sturm St {};
+
+        /* P and P' */
+        St.Deg[0] = Normalize(St.S[0], K, N);
+        St.Count = 1;
+        if (St.Deg[0] <= 0)
+          return St;
+
+        Type D[N + 1] {};
+
+        for (int i = 1; i <= St.Deg[0]; i++)
+          D[i - 1] = St.S[0][i] * i;
+        St.Deg[1] = Normalize(St.S[1], D, St.Deg[0] - 1);
+        St.Count = 2;
+
+        /* Negated remainders */
+        while (St.Count <= N && St.Deg[St.Count - 1] > 0)
+        {
+          const Type *A = St.S[St.Count - 2], *B = St.S[St.Count - 1];
+          const int Da = St.Deg[St.Count - 2], Db = St.Deg[St.Count - 1];
+          Type R[N + 1] {};
+
+          for (int i = 0; i <= Da; i++)
+            R[i] = A[i];
+          for (int i = Da - Db; i >= 0; i--)
+          {
+            const Type Q = R[i + Db] / B[Db];
+
+            for (int j = 0; j <= Db; j++)
+              R[i + j] -= Q * B[j];
+            R[i + Db] = 0;
+          }
+          for (int i = 0; i < Db; i++)
+          {
+            R[i] = -R[i];
+            if (Abs(R[i]) < Eps)
+              R[i] = 0;
+          }
+
+          const int Dr = Normalize(St.S[St.Count], R, Db - 1);
+
+          if (Dr < 0)
+            break;
+          St.Deg[St.Count++] = Dr;
+        }
+        return St;
+      } /* End of 'Sturm' function */
+
+      /* Find real roots in interval function.
+       * ARGUMENTS:
+       *   - interval (left end excluded):
+       *       const Type Lo, Hi;
+       *   - roots array (at least N values, ascending, multiple roots given once):
+       *       Type *Roots;
+       *   - roots tolerance:
+       *       const Type Tol = std::numeric_limits<Type>::epsilon() * 16;
+       * RETURNS:
+       *   (int) number of roots.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr int Roots( const Type Lo, const Type Hi, Type *Roots, const Type Tol = std::numeric_limits<Type>::epsilon() * 16 ) const noexcept
+      {
+        if (!(Lo < Hi))
+          return 0;
+
+        const sturm St = Sturm();
+
+        if (St.Deg[0] <= 0)
+          return 0;
+
+        /* Intervals stack (left halves processed first, so roots go ascending) */
+        struct entry
+        {
+          Type A, B;
+          int Va, Vb, Depth;
+        } Stack[MAX_DEPTH + 1];
+        int Sp = 0, Count = 0;
+
+        /* Sturm members vanish together at multiple roots, so counts are taken right of roots */
+        const auto Changes =
+          [&]( const Type X )
+          {
+            return St.SignChanges((*this)(X) != 0 ? X : X + Tol * Max(Abs(X), Type(1)));
+          };
+
+        Stack[Sp++] = {Lo, Hi, Changes(Lo), Changes(Hi), 0};
+        while (Sp > 0 && Count < N)
+        {
+          const entry E = Stack[--Sp];
+          const int Num = E.Va - E.Vb;
+
+          if (Num <= 0)
+            continue;
+
+          const Type
+            Fa = (*this)(E.A),
+            Fb = (*this)(E.B),
+            Width = E.B - E.A,
+            Scale = Max(Abs(E.A), Abs(E.B));
+          Type Mid = E.A + Width / 2;
+
+          /* Single simple root */
+          if (Num == 1 && ((Fa < 0 && Fb > 0) || (Fa > 0 && Fb < 0) || Fb == 0))
+          {
+            Roots[Count++] = Fb == 0 ? E.B : Refine(E.A, E.B, Fa, Tol);
+            continue;
+          }
+
+          /* Cluster or multiple root */
+          if (E.Depth >= MAX_DEPTH || Width <= Tol * Max(Scale, Type(1)))
+          {
+            Roots[Count++] = Mid;
+            continue;
+          }
+
+          /* Keep split points off roots */
+          if ((*this)(Mid) == 0)
+            Mid += Width / 64;
+
+          const int Vm = Changes(Mid);
+
+          Stack[Sp++] = {Mid, E.B, Vm, E.Vb, E.Depth + 1};
+          Stack[Sp++] = {E.A, Mid, E.Va, Vm, E.Depth + 1};
+        }
+        return Count;
+      } /* End of 'Roots' function */
+
+      /* Find real roots in interval for polynomials array function.
+       * ARGUMENTS:
+       *   - polynomials array:
+       *       const poly *Polys;
+       *   - number of polynomials:
+       *       const int Num;
+       *   - interval (left end excluded):
+       *       const Type Lo, Hi;
+       *   - roots array (N values per polynomial):
+       *       Type *Roots;
+       *   - roots counts array:
+       *       int *Counts;
+       * RETURNS: None.
+       */
+      static void Roots( const poly *Polys, const int Num, const Type Lo, const Type Hi, Type *Roots, int *Counts )
+      {
+        parallel::For(0, Num,
+          [&]( const int Begin, const int End, const int )
+          {
+            for (int i = Begin; i < End; i++)
+              Counts[i] = Polys[i].Roots(Lo, Hi, Roots + static_cast<size_t>(i) * N);
+          }, 256);
+      } /* End of 'Roots' function */
+
+      /* Evaluate polynomials array at common lanes points function.
+       * ARGUMENTS:
+       *   - polynomials coefficients lanes (K[I] holds X^I coefficients of L polynomials):
+       *       const simd<Type, L> *K;
+       *   - points lanes:
+       *       const simd<Type, L> &X;
+       * RETURNS:
+       *   (simd<Type, L>) polynomials values.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<int L>
+        constexpr static simd<Type, L> Eval( const simd<Type, L> *K, const simd<Type, L> &X ) noexcept
+        {
+          simd<Type, L> V = K[N];
+
+          for (int i = N - 1; i >= 0; i--)
+            V = V * X + K[i];
+          return V;
+        } /* End of 'Eval' function */
+
+    private:
+      /* Copy coefficients scaled to unit maximal one function.
+       * ARGUMENTS:
+       *   - destination coefficients:
+       *       Type *Dst;
+       *   - source coefficients:
+       *       const Type *Src;
+       *   - source degree:
+       *       const int Deg;
+       * RETURNS:
+       *   (int) real degree (-1 for zero polynomial).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static int Normalize( Type *Dst, const Type *Src, int Deg ) noexcept
+      {
+        Type M = 0;
+
+        for (int i = 0; i <= Deg; i++)
+          M = Max(M, Abs(Src[i]));
+        while (Deg >= 0 && Src[Deg] == 0)
+          Deg--;
+        if (M == 0)
+          return -1;
+        for (int i = 0; i <= Deg; i++)
+          Dst[i] = Src[i] / M;
+        return Deg;
+      } /* End of 'Normalize' function */
+
+      /* Refine root in sign change interval (bracketed Newton) function.
+       * Newton steps leaving bracket or converging slower than bisection
+       * are replaced by bisection.
+       * ARGUMENTS:
+       *   - bracket:
+       *       Type A, B;
+       *   - polynomial value at A:
+       *       Type Fa;
+       *   - roots tolerance:
+       *       const Type Tol;
+       * RETURNS:
+       *   (Type) root.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Refine( Type A, Type B, Type Fa, const Type Tol ) const noexcept
+      {
+        Type Step = (B - A) / 2, X = A + Step;
+
+        for (int i = 0; i < MAX_NEWTON_ITER; i++)
+        {
+          Type D = 0;
+          const Type F = Eval(X, D);
+
+          if (F == 0)
+            return X;
+
+          /* Shrink bracket */
+          if ((F < 0) == (Fa < 0))
+            A = X, Fa = F;
+          else
+            B = X;
+
+          const Type
+            PrevStep = Step,
+            Xn = D != 0 ? X - F / D : A;
+
+          if (D == 0 || !(Xn > A && Xn < B) || Abs(2 * F) > Abs(PrevStep * D))
+          {
+            Step = (B - A) / 2;
+            X = A + Step;
+          }
+          else
+          {
+            Step = X - Xn;
+            X = Xn;
+          }
+          if (Abs(Step) <= Tol * Max(Abs(X), Type(1)))
+            break;
+        }
+        return X;
+      } /* End of 'Refine' function */
+
+    }; /* End of 'poly' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_poly_h_ */
+
+/* END OF 'mth_poly.h' FILE */
@@ -1,12 +1,14 @@
 /***************************************************************
  * FILE NAME   : mth_quat.h
  * PURPOSE     : Quaternions class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_quat_h_
 #define __mth_quat_h_
 
+#include <limits>
+
 #include "mth_def.h"
 
 /* Math namespace */
@@ -26,7 +28,7 @@ namespace mth
   template<typename Type>
     class quat
     {
-      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in quat");
+      static_assert(number<Type>, "Number type is needed in quat");
 
     public:
       union
@@ -98,6 +100,58 @@ namespace mth
       {
       } /* End of 'quat' function */
 
+      /* Class constructor by rotation tensor (inverse of 'RotateTensor').
+       * Largest of quaternion components is taken from diagonal to
+       * avoid division by small numbers.
+       * ARGUMENTS:
+       *   - rotation tensor:
+       *       const tensor<Type> &R;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      explicit constexpr quat( const tensor<Type> &R ) noexcept : X(0), Y(0), Z(0), W(1)
+      {
+        const Type Trace = R[0][0] + R[1][1] + R[2][2];
+
+        if (Trace > R[0][0] && Trace > R[1][1] && Trace > R[2][2])
+        {
+          const Type S = sqrt(1 + Trace) * 2;
+
+          W = S / 4;
+          X = (R[1][2] - R[2][1]) / S;
+          Y = (R[2][0] - R[0][2]) / S;
+          Z = (R[0][1] - R[1][0]) / S;
+        }
+        else if (R[0][0] >= R[1][1] && R[0][0] >= R[2][2])
+        {
+          const Type S = sqrt(1 + R[0][0] - R[1][1] - R[2][2]) * 2;
+
+          X = S / 4;
+          W = (R[1][2] - R[2][1]) / S;
+          Y = (R[0][1] + R[1][0]) / S;
+          Z = (R[0][2] + R[2][0]) / S;
+        }
+        else if (R[1][1] >= R[2][2])
+        {
+          const Type S = sqrt(1 - R[0][0] + R[1][1] - R[2][2]) * 2;
+
+          Y = S / 4;
+          W = (R[2][0] - R[0][2]) / S;
+          X = (R[0][1] + R[1][0]) / S;
+          Z = (R[1][2] + R[2][1]) / S;
+        }
+        else
+        {
+          const Type S = sqrt(1 - R[0][0] - R[1][1] + R[2][2]) * 2;
+
+          Z = S / 4;
+          W = (R[0][1] - R[1][0]) / S;
+          X = (R[0][2] + R[2][0]) / S;
+          Y = (R[1][2] + R[2][1]) / S;
+        }
+      } /* End of 'quat' function */
+
       /* Get quaternion number function.
        * ARGUMENTS:
        *   - number index:
@@ -354,6 +408,30 @@ namespace mth
         return quat(cos(Angle / 2.0lf), Vec * sin(Angle / 2.0lf));
       } /* End of 'RotateQuat' function */
 
+      /* Get rotation quaternion by rotation vector (exponential map) function.
+       * Small angles use first order expansion, so derivatives by vector
+       * components (e.g. with 'dual' type) stay exact near zero.
+       * ARGUMENTS:
+       *    - rotation vector (axis scaled by angle in radians):
+       *        const vec3<Type> &V;
+       * RETURNS:
+       *   (quat) unit quaternion.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static quat Exp( const vec3<Type> &V ) noexcept
+      {
+        const Type Angle2 = V & V;
+
+        if (Angle2 < std::numeric_limits<Type>::epsilon())
+          return quat(1 - Angle2 / 8, V / 2);
+
+        const Type Angle = sqrt(Angle2);
+
+        return quat(cos(Angle / 2), V * (sin(Angle / 2) / Angle));
+      } /* End of 'Exp' function */
+
       /* Get rotate matrix function.
        * ARGUMENTS: None.
        * RETURNS:
@@ -1,7 +1,7 @@
 /***************************************************************
  * FILE NAME   : mth_rand.h
  * PURPOSE     : Random generators class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_rand_h_
@@ -66,6 +66,109 @@ namespace mth
         return r * v * Dev + Mean;
       } /* End of 'GaussianDistribution' function */
 
+    /* Integer hash function (stateless, usable per pixel/lane in parallel).
+     * ARGUMENTS:
+     *   - number to hash:
+     *       UINT X;
+     * RETURNS:
+     *   (UINT) hash value.
+     */
+#ifdef __CUDA__
+    __host__ __device__
+#endif /* __CUDA__ */
+    constexpr UINT Hash( UINT X ) noexcept
+    {
+      X ^= X >> 16;
+      X *= 0x7FEB352DU;
+      X ^= X >> 15;
+      X *= 0x846CA68BU;
+      X ^= X >> 16;
+      return X;
+    } /* End of 'Hash' function */
+
+    /* Hash based random number from 0 to 1 (1 excluded).
+     * ARGUMENTS:
+     *   - number to hash:
+     *       const UINT X;
+     * RETURNS:
+     *   (Type) number result.
+     */
+#ifdef __CUDA__
+    __host__ __device__
+#endif /* __CUDA__ */
+    template<typename Type = DBL>
+      constexpr Type HashUnit( const UINT X ) noexcept
+      {
+        return static_cast<Type>(Hash(X) >> 8) * static_cast<Type>(1.0 / (1 << 24));
+      } /* End of 'HashUnit' function */
+
+    /* Seedable PCG32 (XSH-RR) random sequence class.
+     * Fully constexpr, so tables built from it can be generated at compile
+     * time, and same seed gives same sequence on every platform (unlike 'rand').
+     */
+    class pcg
+    {
+    private:
+      unsigned long long
+        State = 0, // Generator state
+        Inc = 1;   // Stream increment (odd)
+
+      static constexpr unsigned long long MULTIPLIER = 6364136223846793005ULL;
+
+    public:
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - sequence seed:
+       *       const unsigned long long Seed;
+       *   - stream number (different streams are independent for same seed):
+       *       const unsigned long long Stream = 0;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr pcg( const unsigned long long Seed, const unsigned long long Stream = 0 ) noexcept :
+        Inc((Stream << 1) | 1)
+      {
+        Next();
+        State += Seed;
+        Next();
+      } /* End of 'pcg' function */
+
+      /* Get next random number function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (UINT) uniformly distributed 32 bit number.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr UINT Next( void ) noexcept
+      {
+        const unsigned long long Old = State;
+        const UINT
+          Xorshifted = static_cast<UINT>(((Old >> 18) ^ Old) >> 27),
+          Rot = static_cast<UINT>(Old >> 59);
+
+        State = Old * MULTIPLIER + Inc;
+        return (Xorshifted >> Rot) | (Xorshifted << ((32 - Rot) & 31));
+      } /* End of 'Next' function */
+
+      /* Get next random number from 0 to 1 (1 excluded) function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (Type) number result.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Type = DBL>
+        constexpr Type Unit( void ) noexcept
+        {
+          return static_cast<Type>(Next() >> 8) * static_cast<Type>(1.0 / (1 << 24));
+        } /* End of 'Unit' function */
+
+    }; /* End of 'pcg' class */
+
   } /* end of 'random' namespace */
 
   /* Random generator class */
@@ -1,12 +1,14 @@
 /***************************************************************
  * FILE NAME   : mth_ray.h
  * PURPOSE     : Ray class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_ray_h_
 #define __mth_ray_h_
 
+#include <limits>
+
 #include "mth_def.h"
 
 /* Math namespace */
@@ -20,12 +22,14 @@ namespace mth
   template<typename Type>
     class ray
     {
-      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in ray");
+      static_assert(number<Type>, "Number type is needed in ray");
 
     public:
       vec3<Type>
-        Org, // Ray origin
-        Dir; // Ray normalized direction
+        Org,    // Ray origin
+        Dir,    // Ray normalized direction
+        InvDir; // Ray direction inverse components (1 / Dir, zero gives infinity)
+      UINT DirSign; // Ray direction negative components bits (bit 0 - 'x', 1 - 'y', 2 - 'z')
 
       /* Class default constructor */
 #ifdef __CUDA__
@@ -41,7 +45,7 @@ namespace mth
 #ifdef __CUDA__
       __host__ __device__
 #endif /* __CUDA__ */
-      constexpr ray( const ray &R ) noexcept : Org(R.Org), Dir(R.Dir)
+      constexpr ray( const ray &R ) noexcept : Org(R.Org), Dir(R.Dir), InvDir(R.InvDir), DirSign(R.DirSign)
       {
       } /* End of 'ray' function */
 
@@ -56,8 +60,33 @@ namespace mth
       constexpr ray( const vec3<Type> &O, const vec3<Type> &D ) noexcept : Org(O), Dir(D)
       {
         Dir.Normalize();
+        Precompute();
       } /* End of 'ray' function */
 
+      /* Update ray precomputed direction data function.
+       * Must be called after direct 'Dir' change.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (ray &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray & Precompute( void ) noexcept
+      {
+        constexpr Type Inf = std::numeric_limits<Type>::infinity();
+
+        InvDir = vec3<Type>(
+          Dir.X != 0 ? 1 / Dir.X : Inf,
+          Dir.Y != 0 ? 1 / Dir.Y : Inf,
+          Dir.Z != 0 ? 1 / Dir.Z : Inf);
+        DirSign =
+          static_cast<UINT>(InvDir.X < 0) |
+          static_cast<UINT>(InvDir.Y < 0) << 1 |
+          static_cast<UINT>(InvDir.Z < 0) << 2;
+        return *this;
+      } /* End of 'Precompute' function */
+
       /* Obtain ray point function.
        * ARGUMENTS:
        *   - ray point distance:
@@ -93,28 +122,338 @@ namespace mth
        *   - center of the sphere:
        *       const vec3<Type> &Center;
        *   - radius of the sphere:
-       *       const DBL Radius;
+       *       const Type Radius;
        * RETURNS:
-       *   (DBL) distance to intersection.
+       *   (Type) distance to intersection.
        */
 #ifdef __CUDA__
       __host__ __device__
 #endif /* __CUDA__ */
-      constexpr DBL intersect( const vec3<Type> &Center, const DBL Radius ) const noexcept
+      constexpr Type intersect( const vec3<Type> &Center, const Type Radius ) const noexcept
       {
-        const DBL
+        const Type
           oc2 = (Center - Org) & (Center - Org),
           ok = (Center - Org) & Dir,
           h2 = Radius * Radius - (oc2 - ok * ok);
   
         if (oc2 < Radius * Radius)
-          return ok + sqrtf(h2);
+          return ok + sqrt(h2);
         if (ok < 0 || h2 < 0)
           return -1;
-        return ok - sqrtf(h2);
+        return ok - sqrt(h2);
       } /* End of 'intersect' function */
 
+      /* Intersect with axis aligned box (slab test) function.
+       * Uses precomputed inverse direction and signs. NaN values (ray origin on
+       * slab plane parallel to ray) never widen interval, far distance is scaled
+       * up by rounding error bound, so boxes are never missed by rounding.
+       * ARGUMENTS:
+       *   - box minimal and maximal corners:
+       *       const vec3<Type> &Min, &Max;
+       *   - distances interval (in: interval to clip, out: box interval):
+       *       Type &TNear, &TFar;
+       * RETURNS:
+       *   (bool) true if ray hits box in interval.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr bool IntersectBox( const vec3<Type> &Min, const vec3<Type> &Max, Type &TNear, Type &TFar ) const noexcept
+      {
+        constexpr Type
+          Eps = std::numeric_limits<Type>::epsilon() / 2,
+          Robust = 1 + 2 * (3 * Eps / (1 - 3 * Eps));
+        const Type
+          tx0 = ((DirSign & 1 ? Max.X : Min.X) - Org.X) * InvDir.X,
+          tx1 = ((DirSign & 1 ? Min.X : Max.X) - Org.X) * InvDir.X,
+          ty0 = ((DirSign & 2 ? Max.Y : Min.Y) - Org.Y) * InvDir.Y,
+          ty1 = ((DirSign & 2 ? Min.Y : Max.Y) - Org.Y) * InvDir.Y,
+          tz0 = ((DirSign & 4 ? Max.Z : Min.Z) - Org.Z) * InvDir.Z,
+          tz1 = ((DirSign & 4 ? Min.Z : Max.Z) - Org.Z) * InvDir.Z;
+        Type t0 = TNear, t1 = TFar;
+
+        /* Comparisons with NaN are false, so interval value is kept */
+        t0 = tx0 > t0 ? tx0 : t0;
+        t0 = ty0 > t0 ? ty0 : t0;
+        t0 = tz0 > t0 ? tz0 : t0;
+        t1 = tx1 * Robust < t1 ? tx1 * Robust : t1;
+        t1 = ty1 * Robust < t1 ? ty1 * Robust : t1;
+        t1 = tz1 * Robust < t1 ? tz1 * Robust : t1;
+        if (t0 > t1)
+          return false;
+        TNear = t0;
+        TFar = t1;
+        return true;
+      } /* End of 'IntersectBox' function */
+
+      /* Intersect with axis aligned box (slab test) in [0, inf) function.
+       * ARGUMENTS:
+       *   - box minimal and maximal corners:
+       *       const vec3<Type> &Min, &Max;
+       * RETURNS:
+       *   (bool) true if ray hits box.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr bool IntersectBox( const vec3<Type> &Min, const vec3<Type> &Max ) const noexcept
+      {
+        Type
+          TNear = 0,
+          TFar = std::numeric_limits<Type>::infinity();
+
+        return IntersectBox(Min, Max, TNear, TFar);
+      } /* End of 'IntersectBox' function */
+
+      /* Distance to intersect with triangle find function (Moller-Trumbore).
+       * ARGUMENTS:
+       *   - triangle vertices:
+       *       const vec3<Type> &V0, &V1, &V2;
+       *   - intersection barycentric coordinates (weights of V1 and V2):
+       *       Type &U, &V;
+       * RETURNS:
+       *   (Type) distance to intersection (-1 if no intersection).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type IntersectTriangle( const vec3<Type> &V0, const vec3<Type> &V1, const vec3<Type> &V2, Type &U, Type &V ) const noexcept
+      {
+        const vec3<Type>
+          E1 = V1 - V0,
+          E2 = V2 - V0,
+          P = Dir % E2;
+        const Type Det = E1 & P;
+
+        if (Det == 0)
+          return -1;
+
+        const Type RevDet = 1 / Det;
+        const vec3<Type>
+          Tv = Org - V0,
+          Q = Tv % E1;
+
+        U = (Tv & P) * RevDet;
+        V = (Dir & Q) * RevDet;
+        if (U < 0 || V < 0 || U + V > 1)
+          return -1;
+
+        const Type T = (E2 & Q) * RevDet;
+        return T > 0 ? T : -1;
+      } /* End of 'IntersectTriangle' function */
+
+      /* Distance to intersect with triangle find function (watertight, Woop et al. 2013).
+       * Edges are tested in ray space after shear, shared edges and vertices never
+       * leak rays between adjacent triangles. Float edge tests falling to exact zero
+       * are repeated in double precision.
+       * ARGUMENTS:
+       *   - triangle vertices:
+       *       const vec3<Type> &V0, &V1, &V2;
+       *   - intersection barycentric coordinates (weights of V1 and V2):
+       *       Type &U, &V;
+       * RETURNS:
+       *   (Type) distance to intersection (-1 if no intersection).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type IntersectTriangleWatertight( const vec3<Type> &V0, const vec3<Type> &V1, const vec3<Type> &V2, Type &U, Type &V ) const noexcept
+      {
+        /* Ray space permutation: Z - maximal direction component, winding kept */
+        const vec3<Type> AbsDir(Dir.X < 0 ? -Dir.X : Dir.X, Dir.Y < 0 ? -Dir.Y : Dir.Y, Dir.Z < 0 ? -Dir.Z : Dir.Z);
+        const int kz = AbsDir.X > AbsDir.Y ? (AbsDir.X > AbsDir.Z ? 0 : 2) : (AbsDir.Y > AbsDir.Z ? 1 : 2);
+        int kx = kz == 2 ? 0 : kz + 1, ky = kx == 2 ? 0 : kx + 1;
+
+        if (Dir[kz] < 0)
+        {
+          const int Tmp = kx;
+          kx = ky;
+          ky = Tmp;
+        }
+
+        /* Shear constants */
+        const Type
+          Sx = Dir[kx] / Dir[kz],
+          Sy = Dir[ky] / Dir[kz],
+          Sz = 1 / Dir[kz];
+        const vec3<Type>
+          A = V0 - Org,
+          B = V1 - Org,
+          C = V2 - Org;
+        const Type
+          Ax = A[kx] - Sx * A[kz],
+          Ay = A[ky] - Sy * A[kz],
+          Bx = B[kx] - Sx * B[kz],
+          By = B[ky] - Sy * B[kz],
+          Cx = C[kx] - Sx * C[kz],
+          Cy = C[ky] - Sy * C[kz];
+        Type
+          E0 = Cx * By - Cy * Bx,
+          E1 = Ax * Cy - Ay * Cx,
+          E2 = Bx * Ay - By * Ax;
+
+        if constexpr (std::is_same_v<Type, FLT>)
+          if (E0 == 0 || E1 == 0 || E2 == 0)
+          {
+            E0 = static_cast<Type>(static_cast<DBL>(Cx) * By - static_cast<DBL>(Cy) * Bx);
+            E1 = static_cast<Type>(static_cast<DBL>(Ax) * Cy - static_cast<DBL>(Ay) * Cx);
+            E2 = static_cast<Type>(static_cast<DBL>(Bx) * Ay - static_cast<DBL>(By) * Ax);
+          }
+        if ((E0 < 0 || E1 < 0 || E2 < 0) && (E0 > 0 || E1 > 0 || E2 > 0))
+          return -1;
+
+        const Type Det = E0 + E1 + E2;
+
+        if (Det == 0)
+          return -1;
+
+        const Type
+          RevDet = 1 / Det,
+          T = (E0 * A[kz] + E1 * B[kz] + E2 * C[kz]) * Sz * RevDet;
+
+        if (T <= 0)
+          return -1;
+        U = E1 * RevDet;
+        V = E2 * RevDet;
+        return T;
+      } /* End of 'IntersectTriangleWatertight' function */
+
     }; /* End of 'ray' class */
+
+  /* Ray with differentials class (Igehy 1999).
+   * Keeps origin and direction derivatives by screen X and Y, so surface
+   * footprint of one pixel is known at every hit for texture and noise
+   * level-of-detail. Slicing to 'ray' gives usual ray for intersection.
+   */
+  template<typename Type>
+    class ray_diff : public ray<Type>
+    {
+    public:
+      vec3<Type>
+        DOrgX, DOrgY, // Origin derivatives by screen X and Y
+        DDirX, DDirY; // Normalized direction derivatives by screen X and Y
+
+      /* Class default constructor */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_diff( void ) = default;
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - ray:
+       *       const ray<Type> &R;
+       *   - origin derivatives by screen X and Y:
+       *       const vec3<Type> &DOX, &DOY;
+       *   - normalized direction derivatives by screen X and Y:
+       *       const vec3<Type> &DDX, &DDY;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_diff( const ray<Type> &R,
+                          const vec3<Type> &DOX = vec3<Type>(0), const vec3<Type> &DOY = vec3<Type>(0),
+                          const vec3<Type> &DDX = vec3<Type>(0), const vec3<Type> &DDY = vec3<Type>(0) ) noexcept :
+        ray<Type>(R), DOrgX(DOX), DOrgY(DOY), DDirX(DDX), DDirY(DDY)
+      {
+      } /* End of 'ray_diff' function */
+
+      /* Obtain normalized direction derivative function.
+       * ARGUMENTS:
+       *   - unnormalized direction:
+       *       const vec3<Type> &D;
+       *   - unnormalized direction derivative:
+       *       const vec3<Type> &DD;
+       * RETURNS:
+       *   (vec3<Type>) derivative of D / |D|.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static vec3<Type> NormalizeDiff( const vec3<Type> &D, const vec3<Type> &DD ) noexcept
+      {
+        const Type Len2 = D & D;
+
+        return (DD * Len2 - D * (D & DD)) / (Len2 * D.Length());
+      } /* End of 'NormalizeDiff' function */
+
+      /* Transfer differentials to surface hit point function.
+       * ARGUMENTS:
+       *   - distance to hit:
+       *       const Type T;
+       *   - surface normal at hit:
+       *       const vec3<Type> &N;
+       * RETURNS:
+       *   (ray_diff) ray with origin at hit point, same direction and hit point differentials.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_diff Transfer( const Type T, const vec3<Type> &N ) const noexcept
+      {
+        const Type DN = this->Dir & N;
+        ray_diff Res(*this);
+
+        Res.Org = (*this)(T);
+        Res.DOrgX = DOrgX + DDirX * T;
+        Res.DOrgY = DOrgY + DDirY * T;
+
+        /* Project to tangent plane (grazing rays keep unprojected values) */
+        if (DN != 0)
+        {
+          Res.DOrgX -= this->Dir * ((Res.DOrgX & N) / DN);
+          Res.DOrgY -= this->Dir * ((Res.DOrgY & N) / DN);
+        }
+        return Res;
+      } /* End of 'Transfer' function */
+
+      /* Reflect ray with differentials at transferred hit function.
+       * ARGUMENTS:
+       *   - surface normal at ray origin:
+       *       const vec3<Type> &N;
+       *   - normal derivatives by screen X and Y (zero for planar surface):
+       *       const vec3<Type> &DNX = vec3<Type>(0), &DNY = vec3<Type>(0);
+       * RETURNS:
+       *   (ray_diff) reflected ray.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_diff Reflect( const vec3<Type> &N,
+                                  const vec3<Type> &DNX = vec3<Type>(0), const vec3<Type> &DNY = vec3<Type>(0) ) const noexcept
+      {
+        const vec3<Type> &D = this->Dir;
+        const Type DN = D & N;
+        ray_diff Res(ray<Type>(this->Org, D - N * (2 * DN)), DOrgX, DOrgY);
+
+        Res.DDirX = DDirX - (DNX * DN + N * ((DDirX & N) + (D & DNX))) * 2;
+        Res.DDirY = DDirY - (DNY * DN + N * ((DDirY & N) + (D & DNY))) * 2;
+        return Res;
+      } /* End of 'Reflect' function */
+
+      /* Get pixel footprint width function.
+       * ARGUMENTS:
+       *   - distance along ray (0 for transferred ray at hit):
+       *       const Type T = 0;
+       * RETURNS:
+       *   (Type) footprint width (longest axis of pixel parallelogram).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Footprint( const Type T = 0 ) const noexcept
+      {
+        const Type
+          Lx = (DOrgX + DDirX * T).Length2(),
+          Ly = (DOrgY + DDirY * T).Length2();
+
+        if constexpr (std::is_same_v<Type, FLT>)
+          return sqrtf(Lx > Ly ? Lx : Ly);
+        else
+          return sqrt(Lx > Ly ? Lx : Ly);
+      } /* End of 'Footprint' function */
+
+    }; /* End of 'ray_diff' class */
 } /* end of 'mth' namespace */
 
 #endif /* __mth_ray_h_ */
@@ -0,0 +1,257 @@
+/***************************************************************
+ * FILE NAME   : mth_ray_packet.h
+ * PURPOSE     : Rays packet class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_ray_packet_h_
+#define __mth_ray_packet_h_
+
+#include <limits>
+
+#include "mth_def.h"
+#include "mth_simd.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class ray;
+
+  /* Rays packet class (structure of arrays, one ray per lane) */
+  template<typename Type, int N>
+    class ray_packet
+    {
+      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in ray_packet");
+
+    public:
+      static const int SIZE = N;
+
+      simd<Type, N>
+        Org[3],    // Rays origins components (0 - 'x', 1 - 'y', 2 - 'z')
+        Dir[3],    // Rays normalized directions components (0 - 'x', 1 - 'y', 2 - 'z')
+        InvDir[3]; // Rays directions inverse components (1 / Dir, zero gives infinity)
+
+      /* Class default constructor */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_packet( void ) = default;
+
+      /* Class constructor (all lanes share one origin).
+       * ARGUMENTS:
+       *   - rays origin:
+       *       const vec3<Type> &O;
+       *   - rays directions components (not normalized):
+       *       const simd<Type, N> &Dx, &Dy, &Dz;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_packet( const vec3<Type> &O, const simd<Type, N> &Dx, const simd<Type, N> &Dy, const simd<Type, N> &Dz ) noexcept :
+        Org{simd<Type, N>(O.X), simd<Type, N>(O.Y), simd<Type, N>(O.Z)}, Dir{Dx, Dy, Dz}
+      {
+        Normalize();
+        Precompute();
+      } /* End of 'ray_packet' function */
+
+      /* Update rays precomputed direction data function.
+       * Must be called after direct 'Dir' change.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (ray_packet &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_packet & Precompute( void ) noexcept
+      {
+        const simd<Type, N>
+          Zero(0),
+          Inf(std::numeric_limits<Type>::infinity());
+
+        for (int i = 0; i < 3; i++)
+          InvDir[i] = Select(Dir[i] != Zero, simd<Type, N>(1) / Select(Dir[i] != Zero, Dir[i], simd<Type, N>(1)), Inf);
+        return *this;
+      } /* End of 'Precompute' function */
+
+      /* Normalize rays directions function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (ray_packet &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray_packet & Normalize( void ) noexcept
+      {
+        const simd<Type, N> Len2 = Dir[0] * Dir[0] + Dir[1] * Dir[1] + Dir[2] * Dir[2];
+        const simd<Type, N> RevLen = Select(Len2 > simd<Type, N>(0), simd<Type, N>(1) / Sqrt(Len2), simd<Type, N>(1));
+
+        Dir[0] *= RevLen;
+        Dir[1] *= RevLen;
+        Dir[2] *= RevLen;
+        return *this;
+      } /* End of 'Normalize' function */
+
+      /* Set lane ray function.
+       * ARGUMENTS:
+       *   - lane index:
+       *       const int Lane;
+       *   - ray to store:
+       *       const ray<Type> &R;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr void Set( const int Lane, const ray<Type> &R ) noexcept
+      {
+        Org[0][Lane] = R.Org.X;
+        Org[1][Lane] = R.Org.Y;
+        Org[2][Lane] = R.Org.Z;
+        Dir[0][Lane] = R.Dir.X;
+        Dir[1][Lane] = R.Dir.Y;
+        Dir[2][Lane] = R.Dir.Z;
+        InvDir[0][Lane] = R.InvDir.X;
+        InvDir[1][Lane] = R.InvDir.Y;
+        InvDir[2][Lane] = R.InvDir.Z;
+      } /* End of 'Set' function */
+
+      /* Get lane ray function.
+       * ARGUMENTS:
+       *   - lane index:
+       *       const int Lane;
+       * RETURNS:
+       *   (ray<Type>) lane ray.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr ray<Type> Get( const int Lane ) const noexcept
+      {
+        return ray<Type>(vec3<Type>(Org[0][Lane], Org[1][Lane], Org[2][Lane]),
+                         vec3<Type>(Dir[0][Lane], Dir[1][Lane], Dir[2][Lane]));
+      } /* End of 'Get' function */
+
+      /* Distances to intersect with sphere find function.
+       * Branch-free lanes version of 'ray::intersect': rays starting inside
+       * sphere get far intersection, missed lanes get -1.
+       * ARGUMENTS:
+       *   - center of the sphere:
+       *       const vec3<Type> &Center;
+       *   - radius of the sphere:
+       *       const Type Radius;
+       *   - lanes hit mask:
+       *       simd_mask<Type, N> &Hit;
+       * RETURNS:
+       *   (simd<Type, N>) distances to intersection (-1 if no intersection).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd<Type, N> Intersect( const vec3<Type> &Center, const Type Radius, simd_mask<Type, N> &Hit ) const noexcept
+      {
+        const simd<Type, N>
+          Ocx = simd<Type, N>(Center.X) - Org[0],
+          Ocy = simd<Type, N>(Center.Y) - Org[1],
+          Ocz = simd<Type, N>(Center.Z) - Org[2],
+          R2(Radius * Radius),
+          Oc2 = Ocx * Ocx + Ocy * Ocy + Ocz * Ocz,
+          Ok = Ocx * Dir[0] + Ocy * Dir[1] + Ocz * Dir[2],
+          H2 = R2 - (Oc2 - Ok * Ok),
+          H = Sqrt(Max(H2, simd<Type, N>(0)));
+        const simd_mask<Type, N> Inside = Oc2 < R2;
+
+        Hit = Inside | ((Ok >= simd<Type, N>(0)) & (H2 >= simd<Type, N>(0)));
+        return Select(Hit, Select(Inside, Ok + H, Ok - H), simd<Type, N>(-1));
+      } /* End of 'Intersect' function */
+
+      /* Closest intersection with spheres array find function.
+       * Every sphere is tested against all lanes at once, each lane keeps
+       * its closest hit distance and sphere index.
+       * ARGUMENTS:
+       *   - spheres centers and radii arrays:
+       *       const vec3<Type> *Centers;
+       *       const Type *Radii;
+       *   - number of spheres:
+       *       const int Count;
+       *   - lanes closest distances (in: maximal distances, out: closest hits):
+       *       simd<Type, N> &T;
+       *   - lanes closest spheres indices (updated for hit lanes only):
+       *       simd<int, N> &Ind;
+       * RETURNS:
+       *   (simd_mask<Type, N>) lanes which found closer hit mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> IntersectSpheres( const vec3<Type> *Centers, const Type *Radii, const int Count,
+                                                     simd<Type, N> &T, simd<int, N> &Ind ) const noexcept
+      {
+        simd_mask<Type, N> Found(false);
+
+        for (int i = 0; i < Count; i++)
+        {
+          simd_mask<Type, N> Hit;
+          const simd<Type, N> Ti = Intersect(Centers[i], Radii[i], Hit);
+          const simd_mask<Type, N> Closer = Hit & (Ti < T);
+
+          T = Select(Closer, Ti, T);
+          Ind = Select(Closer, simd<int, N>(i), Ind);
+          Found |= Closer;
+        }
+        return Found;
+      } /* End of 'IntersectSpheres' function */
+
+      /* Intersect with axis aligned box (slab test) function.
+       * Lanes version of 'ray::IntersectBox' with the same NaN and rounding handling.
+       * ARGUMENTS:
+       *   - box minimal and maximal corners:
+       *       const vec3<Type> &Min, &Max;
+       *   - lanes distances intervals (in: intervals to clip, out: box intervals for hit lanes):
+       *       simd<Type, N> &TNear, &TFar;
+       * RETURNS:
+       *   (simd_mask<Type, N>) lanes hit mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> IntersectBox( const vec3<Type> &Min, const vec3<Type> &Max,
+                                                 simd<Type, N> &TNear, simd<Type, N> &TFar ) const noexcept
+      {
+        constexpr Type
+          Eps = std::numeric_limits<Type>::epsilon() / 2,
+          Robust = 1 + 2 * (3 * Eps / (1 - 3 * Eps));
+        const simd<Type, N> Zero(0);
+        simd<Type, N> t0 = TNear, t1 = TFar;
+
+        for (int i = 0; i < 3; i++)
+        {
+          const simd_mask<Type, N> Neg = InvDir[i] < Zero;
+          const simd<Type, N>
+            Lo(Min[i]),
+            Hi(Max[i]),
+            tn = (Select(Neg, Hi, Lo) - Org[i]) * InvDir[i],
+            tf = (Select(Neg, Lo, Hi) - Org[i]) * InvDir[i] * simd<Type, N>(Robust);
+
+          /* Comparisons with NaN are false, so interval value is kept */
+          t0 = Select(tn > t0, tn, t0);
+          t1 = Select(tf < t1, tf, t1);
+        }
+        const simd_mask<Type, N> Hit = t0 <= t1;
+
+        TNear = Select(Hit, t0, TNear);
+        TFar = Select(Hit, t1, TFar);
+        return Hit;
+      } /* End of 'IntersectBox' function */
+
+    }; /* End of 'ray_packet' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_ray_packet_h_ */
+
+/* END OF 'mth_ray_packet.h' FILE */
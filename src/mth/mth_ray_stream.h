@@ -0,0 +1,221 @@
+/***************************************************************
+ * FILE NAME   : mth_ray_stream.h
+ * PURPOSE     : Rays stream class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_ray_stream_h_
+#define __mth_ray_stream_h_
+
+#include <vector>
+
+#include "mth_def.h"
+#include "mth_box.h"
+#include "mth_parallel.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class ray;
+
+  /* Rays stream class.
+   * Large incoherent rays batch (e.g. diffuse bounces) is reordered by
+   * direction octant and origin Morton code, so neighbouring rays visit
+   * the same acceleration structure nodes and primitives.
+   */
+  template<typename Type>
+    class ray_stream
+    {
+      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in ray_stream");
+
+    public:
+      static const int MORTON_BITS = 9; // Origin quantization bits per axis
+
+      std::vector<ray<Type>> Rays; // Stream rays (in sorted order after 'Sort')
+      std::vector<int> Ids;        // Rays indices in adding order
+
+    private:
+      /* Spread 10 low bits to every third bit function.
+       * ARGUMENTS:
+       *   - value to spread:
+       *       UINT X;
+       * RETURNS:
+       *   (UINT) spread bits.
+       */
+      constexpr static UINT Spread3( UINT X ) noexcept
+      {
+        X &= 0x3FF;
+        X = (X | (X << 16)) & 0x030000FF;
+        X = (X | (X << 8)) & 0x0300F00F;
+        X = (X | (X << 4)) & 0x030C30C3;
+        X = (X | (X << 2)) & 0x09249249;
+        return X;
+      } /* End of 'Spread3' function */
+
+    public:
+      /* Evaluate 3D Morton code function.
+       * ARGUMENTS:
+       *   - cell coordinates (10 bits each):
+       *       const UINT X, Y, Z;
+       * RETURNS:
+       *   (UINT) interleaved code.
+       */
+      constexpr static UINT Morton( const UINT X, const UINT Y, const UINT Z ) noexcept
+      {
+        return Spread3(X) | (Spread3(Y) << 1) | (Spread3(Z) << 2);
+      } /* End of 'Morton' function */
+
+      /* Evaluate ray sort key function.
+       * ARGUMENTS:
+       *   - ray:
+       *       const ray<Type> &R;
+       *   - origins bounds:
+       *       const box<Type> &Bounds;
+       * RETURNS:
+       *   (UINT) key (direction octant in high bits, origin Morton code in low bits).
+       */
+      constexpr static UINT Key( const ray<Type> &R, const box<Type> &Bounds ) noexcept
+      {
+        const vec3<Type> S = Bounds.Size();
+        UINT Cell[3];
+
+        for (int i = 0; i < 3; i++)
+        {
+          const Type C = S[i] > 0 ? (R.Org[i] - Bounds.Min[i]) / S[i] * (1 << MORTON_BITS) : 0;
+
+          Cell[i] = C <= 0 ? 0 : C >= (1 << MORTON_BITS) - 1 ? (1 << MORTON_BITS) - 1 : static_cast<UINT>(C);
+        }
+        return (R.DirSign << (3 * MORTON_BITS)) | Morton(Cell[0], Cell[1], Cell[2]);
+      } /* End of 'Key' function */
+
+      /* Class default constructor */
+      ray_stream( void ) = default;
+
+      /* Clear stream function.
+       * ARGUMENTS: None.
+       * RETURNS: None.
+       */
+      void Clear( void )
+      {
+        Rays.clear();
+        Ids.clear();
+      } /* End of 'Clear' function */
+
+      /* Add ray to stream function.
+       * ARGUMENTS:
+       *   - ray to add:
+       *       const ray<Type> &R;
+       * RETURNS:
+       *   (int) ray index.
+       */
+      int Add( const ray<Type> &R )
+      {
+        Ids.push_back(static_cast<int>(Rays.size()));
+        Rays.push_back(R);
+        return Ids.back();
+      } /* End of 'Add' function */
+
+      /* Get rays count function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (int) number of rays.
+       */
+      int Size( void ) const noexcept
+      {
+        return static_cast<int>(Rays.size());
+      } /* End of 'Size' function */
+
+      /* Sort rays by direction octant and origin Morton code function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (ray_stream &) self reference.
+       */
+      ray_stream & Sort( void )
+      {
+        const int Count = Size();
+
+        if (Count < 2)
+          return *this;
+
+        /* Origins bounds */
+        box<Type> Bounds = box<Type>::Empty();
+
+        for (const ray<Type> &R : Rays)
+          Bounds |= R.Org;
+
+        /* Keys (in parallel) */
+        std::vector<UINT> Keys(Count), Keys2(Count);
+        std::vector<int> Perm(Count), Perm2(Count);
+
+        parallel::For(0, Count,
+          [&]( const int Begin, const int End, const int )
+          {
+            for (int i = Begin; i < End; i++)
+            {
+              Keys[i] = Key(Rays[i], Bounds);
+              Perm[i] = i;
+            }
+          }, 1 << 14);
+
+        /* LSD radix sort (8 bits per pass) */
+        const int Bits = 3 * MORTON_BITS + 3;
+
+        for (int Shift = 0; Shift < Bits; Shift += 8)
+        {
+          int Start[257] {};
+
+          for (int i = 0; i < Count; i++)
+            Start[((Keys[i] >> Shift) & 0xFF) + 1]++;
+          for (int b = 0; b < 256; b++)
+            Start[b + 1] += Start[b];
+          for (int i = 0; i < Count; i++)
+          {
+            const int Dst = Start[(Keys[i] >> Shift) & 0xFF]++;
+
+            Keys2[Dst] = Keys[i];
+            Perm2[Dst] = Perm[i];
+          }
+          Keys.swap(Keys2);
+          Perm.swap(Perm2);
+        }
+
+        /* Apply permutation */
+        std::vector<ray<Type>> Sorted;
+        std::vector<int> SortedIds(Count);
+
+        Sorted.reserve(Count);
+        for (int i = 0; i < Count; i++)
+        {
+          Sorted.push_back(Rays[Perm[i]]);
+          SortedIds[i] = Ids[Perm[i]];
+        }
+        Rays.swap(Sorted);
+        Ids.swap(SortedIds);
+        return *this;
+      } /* End of 'Sort' function */
+
+      /* Scatter per ray results to adding order function.
+       * ARGUMENTS:
+       *   - results in stream order:
+       *       const Data *Src;
+       *   - results in adding order:
+       *       Data *Dst;
+       * RETURNS: None.
+       */
+      template<typename Data>
+        void Scatter( const Data *Src, Data *Dst ) const
+        {
+          for (int i = 0; i < Size(); i++)
+            Dst[Ids[i]] = Src[i];
+        } /* End of 'Scatter' function */
+
+    }; /* End of 'ray_stream' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_ray_stream_h_ */
+
+/* END OF 'mth_ray_stream.h' FILE */
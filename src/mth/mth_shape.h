@@ -0,0 +1,688 @@
+/***************************************************************
+ * FILE NAME   : mth_shape.h
+ * PURPOSE     : Analytic shapes intersection module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_shape_h_
+#define __mth_shape_h_
+
+#include <limits>
+
+#include "mth_def.h"
+#include "mth_simd.h"
+#include "mth_box.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class ray;
+  template<typename Type, int N>
+    class ray_packet;
+
+  /* Shapes share one lanes kernel for scalar rays (Lane = Type, Mask = bool)
+   * and packets (Lane = simd<Type, N>, Mask = simd_mask<Type, N>):
+   *   Interval(Org, Dir, InvDir, T0, T1, Valid)
+   * gives ray parameter interval [T0, T1] inside shape, so all shapes
+   * follow 'ray::intersect' convention: entry distance, exit distance for
+   * origin inside shape and -1 for miss.
+   */
+
+  /* Lanes vector by vector dot product function.
+   * ARGUMENTS:
+   *   - lanes vector components:
+   *       const Lane *A;
+   *   - vector:
+   *       const vec3<Type> &B;
+   * RETURNS:
+   *   (Lane) dot product lanes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Lane, typename Type>
+    constexpr Lane LaneDot( const Lane *A, const vec3<Type> &B ) noexcept
+    {
+      return A[0] * Lane(B.X) + A[1] * Lane(B.Y) + A[2] * Lane(B.Z);
+    } /* End of 'LaneDot' function */
+
+  /* Vector by lanes vector cross product function.
+   * ARGUMENTS:
+   *   - vector:
+   *       const vec3<Type> &A;
+   *   - lanes vector components:
+   *       const Lane *B;
+   *   - cross product lanes components:
+   *       Lane *C;
+   * RETURNS: None.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Lane, typename Type>
+    constexpr void LaneCross( const vec3<Type> &A, const Lane *B, Lane *C ) noexcept
+    {
+      C[0] = Lane(A.Y) * B[2] - Lane(A.Z) * B[1];
+      C[1] = Lane(A.Z) * B[0] - Lane(A.X) * B[2];
+      C[2] = Lane(A.X) * B[1] - Lane(A.Y) * B[0];
+    } /* End of 'LaneCross' function */
+
+  /* Lanes slab interval clip function.
+   * ARGUMENTS:
+   *   - slab bounds along direction:
+   *       const Lane Lo, Hi;
+   *   - ray origin projection and its inverse direction projection:
+   *       const Lane O, Inv;
+   *   - interval to clip (NaN bounds keep interval):
+   *       Lane &T0, &T1;
+   * RETURNS: None.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Lane>
+    constexpr void LaneSlab( const Lane Lo, const Lane Hi, const Lane O, const Lane Inv, Lane &T0, Lane &T1 ) noexcept
+    {
+      const auto Neg = Inv < Lane(0);
+      const Lane
+        tn = (Select(Neg, Hi, Lo) - O) * Inv,
+        tf = (Select(Neg, Lo, Hi) - O) * Inv;
+
+      T0 = Select(tn > T0, tn, T0);
+      T1 = Select(tf < T1, tf, T1);
+    } /* End of 'LaneSlab' function */
+
+  /* Sphere class */
+  template<typename Type>
+    class sphere
+    {
+      static_assert(number<Type>, "Number type is needed in sphere");
+
+    public:
+      vec3<Type> Center; // Sphere center
+      Type Radius;       // Sphere radius
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - center and radius of the sphere:
+       *       const vec3<Type> &C;
+       *       const Type R;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sphere( const vec3<Type> &C = vec3<Type>(0), const Type R = 1 ) noexcept : Center(C), Radius(R)
+      {
+      } /* End of 'sphere' function */
+
+      /* Ray interval inside shape function.
+       * ARGUMENTS:
+       *   - rays origins, normalized directions and inverse directions components:
+       *       const Lane *Org, *Dir, *InvDir;
+       *   - interval inside shape:
+       *       Lane &T0, &T1;
+       *   - interval valid mask:
+       *       Mask &Valid;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename Mask>
+        constexpr void Interval( const Lane *Org, const Lane *Dir, const Lane *InvDir, Lane &T0, Lane &T1, Mask &Valid ) const noexcept
+        {
+          const Lane
+            Ocx = Org[0] - Lane(Center.X),
+            Ocy = Org[1] - Lane(Center.Y),
+            Ocz = Org[2] - Lane(Center.Z),
+            B = Ocx * Dir[0] + Ocy * Dir[1] + Ocz * Dir[2],
+            H = B * B - (Ocx * Ocx + Ocy * Ocy + Ocz * Ocz - Lane(Radius * Radius)),
+            S = Sqrt(Max(H, Lane(0)));
+
+          Valid = H >= Lane(0);
+          T0 = -B - S;
+          T1 = -B + S;
+        } /* End of 'Interval' function */
+
+    }; /* End of 'sphere' class */
+
+  /* Plane (two-sided) class */
+  template<typename Type>
+    class plane
+    {
+      static_assert(number<Type>, "Number type is needed in plane");
+
+    public:
+      vec3<Type> N; // Plane normal
+      Type D;       // Plane distance (plane points P satisfy N & P == D)
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - plane point and normal:
+       *       const vec3<Type> &P, &Normal;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr plane( const vec3<Type> &P = vec3<Type>(0), const vec3<Type> &Normal = vec3<Type>(0, 1, 0) ) noexcept :
+        N(Normal.Normalizing()), D(N & P)
+      {
+      } /* End of 'plane' function */
+
+      /* Ray interval inside shape function.
+       * ARGUMENTS:
+       *   - rays origins, normalized directions and inverse directions components:
+       *       const Lane *Org, *Dir, *InvDir;
+       *   - interval inside shape (single point):
+       *       Lane &T0, &T1;
+       *   - interval valid mask:
+       *       Mask &Valid;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename Mask>
+        constexpr void Interval( const Lane *Org, const Lane *Dir, const Lane *InvDir, Lane &T0, Lane &T1, Mask &Valid ) const noexcept
+        {
+          const Lane Dn = LaneDot(Dir, N);
+
+          Valid = Dn != Lane(0);
+          T0 = T1 = (Lane(D) - LaneDot(Org, N)) / Select(Valid, Dn, Lane(1));
+        } /* End of 'Interval' function */
+
+    }; /* End of 'plane' class */
+
+  /* Disc (two-sided) class */
+  template<typename Type>
+    class disc
+    {
+      static_assert(number<Type>, "Number type is needed in disc");
+
+    public:
+      vec3<Type> Center, N; // Disc center and normal
+      Type Radius;          // Disc radius
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - disc center and normal:
+       *       const vec3<Type> &C, &Normal;
+       *   - disc radius:
+       *       const Type R;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr disc( const vec3<Type> &C = vec3<Type>(0), const vec3<Type> &Normal = vec3<Type>(0, 1, 0), const Type R = 1 ) noexcept :
+        Center(C), N(Normal.Normalizing()), Radius(R)
+      {
+      } /* End of 'disc' function */
+
+      /* Ray interval inside shape function.
+       * ARGUMENTS:
+       *   - rays origins, normalized directions and inverse directions components:
+       *       const Lane *Org, *Dir, *InvDir;
+       *   - interval inside shape (single point):
+       *       Lane &T0, &T1;
+       *   - interval valid mask:
+       *       Mask &Valid;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename Mask>
+        constexpr void Interval( const Lane *Org, const Lane *Dir, const Lane *InvDir, Lane &T0, Lane &T1, Mask &Valid ) const noexcept
+        {
+          const Lane Dn = LaneDot(Dir, N);
+          Mask IsCross = Dn != Lane(0);
+          const Lane
+            T = (Lane(N & Center) - LaneDot(Org, N)) / Select(IsCross, Dn, Lane(1)),
+            Px = Org[0] + Dir[0] * T - Lane(Center.X),
+            Py = Org[1] + Dir[1] * T - Lane(Center.Y),
+            Pz = Org[2] + Dir[2] * T - Lane(Center.Z);
+
+          Valid = IsCross & (Px * Px + Py * Py + Pz * Pz <= Lane(Radius * Radius));
+          T0 = T1 = T;
+        } /* End of 'Interval' function */
+
+    }; /* End of 'disc' class */
+
+  /* Oriented box class */
+  template<typename Type>
+    class obox
+    {
+      static_assert(number<Type>, "Number type is needed in obox");
+
+    public:
+      vec3<Type> Center;  // Box center
+      vec3<Type> Axis[3]; // Box orthonormal axes
+      vec3<Type> Half;    // Box half sizes along axes
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - box center:
+       *       const vec3<Type> &C;
+       *   - box orthonormal axes:
+       *       const vec3<Type> &A0, &A1, &A2;
+       *   - box half sizes along axes:
+       *       const vec3<Type> &H;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr obox( const vec3<Type> &C = vec3<Type>(0),
+                      const vec3<Type> &A0 = vec3<Type>(1, 0, 0), const vec3<Type> &A1 = vec3<Type>(0, 1, 0), const vec3<Type> &A2 = vec3<Type>(0, 0, 1),
+                      const vec3<Type> &H = vec3<Type>(1) ) noexcept :
+        Center(C), Axis{A0, A1, A2}, Half(H)
+      {
+      } /* End of 'obox' function */
+
+      /* Ray interval inside shape function.
+       * ARGUMENTS:
+       *   - rays origins, normalized directions and inverse directions components:
+       *       const Lane *Org, *Dir, *InvDir;
+       *   - interval inside shape:
+       *       Lane &T0, &T1;
+       *   - interval valid mask:
+       *       Mask &Valid;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename Mask>
+        constexpr void Interval( const Lane *Org, const Lane *Dir, const Lane *InvDir, Lane &T0, Lane &T1, Mask &Valid ) const noexcept
+        {
+          const Lane Oc[3] = {Org[0] - Lane(Center.X), Org[1] - Lane(Center.Y), Org[2] - Lane(Center.Z)};
+
+          T0 = Lane(-std::numeric_limits<Type>::infinity());
+          T1 = Lane(std::numeric_limits<Type>::infinity());
+          for (int i = 0; i < 3; i++)
+          {
+            const Lane D = LaneDot(Dir, Axis[i]);
+            const Mask IsZero = D == Lane(0);
+
+            LaneSlab(Lane(-Half[i]), Lane(Half[i]), LaneDot(Oc, Axis[i]),
+                     Select(IsZero, Lane(std::numeric_limits<Type>::infinity()), Lane(1) / Select(IsZero, Lane(1), D)), T0, T1);
+          }
+          Valid = T0 <= T1;
+        } /* End of 'Interval' function */
+
+    }; /* End of 'obox' class */
+
+  /* Capped cylinder class */
+  template<typename Type>
+    class cylinder
+    {
+      static_assert(number<Type>, "Number type is needed in cylinder");
+
+    public:
+      vec3<Type> A, B; // Cylinder axis end points
+      Type Radius;     // Cylinder radius
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - cylinder axis end points:
+       *       const vec3<Type> &P0, &P1;
+       *   - cylinder radius:
+       *       const Type R;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr cylinder( const vec3<Type> &P0 = vec3<Type>(0), const vec3<Type> &P1 = vec3<Type>(0, 1, 0), const Type R = 1 ) noexcept :
+        A(P0), B(P1), Radius(R)
+      {
+      } /* End of 'cylinder' function */
+
+      /* Ray interval inside infinite cylinder and axis slab function.
+       * ARGUMENTS:
+       *   - rays origins and normalized directions components:
+       *       const Lane *Org, *Dir;
+       *   - intervals inside infinite cylinder and inside axis slab (between caps planes):
+       *       Lane &TB0, &TB1, &TS0, &TS1;
+       * RETURNS:
+       *   (Mask) infinite cylinder interval valid mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename Mask>
+        constexpr Mask BodyInterval( const Lane *Org, const Lane *Dir, Lane &TB0, Lane &TB1, Lane &TS0, Lane &TS1 ) const noexcept
+        {
+          const vec3<Type> Ba = B - A;
+          const Type
+            Baba = Ba & Ba,
+            Eps = std::numeric_limits<Type>::epsilon(),
+            Inf = std::numeric_limits<Type>::infinity();
+          const Lane
+            Oc[3] = {Org[0] - Lane(A.X), Org[1] - Lane(A.Y), Org[2] - Lane(A.Z)},
+            Bard = LaneDot(Dir, Ba),
+            Baoc = LaneDot(Oc, Ba);
+          Lane Cd[3], Co[3];
+
+          /* Quadratic coefficients by Lagrange identity (no cancellation for near parallel rays):
+           * (Ba x D) . (Ba x Oc) = Baba (D . Oc) - Bard Baoc */
+          LaneCross(Ba, Dir, Cd);
+          LaneCross(Ba, Oc, Co);
+
+          const Lane
+            K2 = Cd[0] * Cd[0] + Cd[1] * Cd[1] + Cd[2] * Cd[2],
+            K1 = Cd[0] * Co[0] + Cd[1] * Co[1] + Cd[2] * Co[2],
+            K0 = Co[0] * Co[0] + Co[1] * Co[1] + Co[2] * Co[2] - Lane(Radius * Radius * Baba),
+            H = K1 * K1 - K2 * K0,
+            S = Sqrt(Max(H, Lane(0))),
+            Dd = Dir[0] * Dir[0] + Dir[1] * Dir[1] + Dir[2] * Dir[2];
+          /* Ray parallel to axis (angle sine below epsilon) is inside body for all parameters or never */
+          const Mask
+            IsPar = K2 <= Lane(Baba * Eps * Eps) * Dd,
+            IsCross = K2 > Lane(Baba * Eps * Eps) * Dd;
+          const Lane RevK2 = Lane(1) / Select(IsPar, Lane(1), K2);
+          const Mask IsBard = Bard != Lane(0);
+
+          TB0 = Select(IsPar, Lane(-Inf), (-K1 - S) * RevK2);
+          TB1 = Select(IsPar, Lane(Inf), (-K1 + S) * RevK2);
+          TS0 = Lane(-Inf);
+          TS1 = Lane(Inf);
+          LaneSlab(Lane(0), Lane(Baba), Baoc, Select(IsBard, Lane(1) / Select(IsBard, Bard, Lane(1)), Lane(Inf)), TS0, TS1);
+          return (IsPar & (K0 <= Lane(0))) | (IsCross & (H >= Lane(0)));
+        } /* End of 'BodyInterval' function */
+
+      /* Ray interval inside shape function.
+       * ARGUMENTS:
+       *   - rays origins, normalized directions and inverse directions components:
+       *       const Lane *Org, *Dir, *InvDir;
+       *   - interval inside shape:
+       *       Lane &T0, &T1;
+       *   - interval valid mask:
+       *       Mask &Valid;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename Mask>
+        constexpr void Interval( const Lane *Org, const Lane *Dir, const Lane *InvDir, Lane &T0, Lane &T1, Mask &Valid ) const noexcept
+        {
+          Lane TB0, TB1, TS0, TS1;
+          const Mask IsBody = BodyInterval<Lane, Mask>(Org, Dir, TB0, TB1, TS0, TS1);
+
+          T0 = Max(TB0, TS0);
+          T1 = Min(TB1, TS1);
+          Valid = IsBody & (T0 <= T1);
+        } /* End of 'Interval' function */
+
+    }; /* End of 'cylinder' class */
+
+  /* Capsule (swept sphere) class */
+  template<typename Type>
+    class capsule
+    {
+      static_assert(number<Type>, "Number type is needed in capsule");
+
+    public:
+      vec3<Type> A, B; // Capsule axis end points
+      Type Radius;     // Capsule radius
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - capsule axis end points:
+       *       const vec3<Type> &P0, &P1;
+       *   - capsule radius:
+       *       const Type R;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr capsule( const vec3<Type> &P0 = vec3<Type>(0), const vec3<Type> &P1 = vec3<Type>(0, 1, 0), const Type R = 1 ) noexcept :
+        A(P0), B(P1), Radius(R)
+      {
+      } /* End of 'capsule' function */
+
+      /* Ray interval inside shape function.
+       * Capsule is convex union of open cylinder and end spheres,
+       * so its interval spans all parts intervals.
+       * ARGUMENTS:
+       *   - rays origins, normalized directions and inverse directions components:
+       *       const Lane *Org, *Dir, *InvDir;
+       *   - interval inside shape:
+       *       Lane &T0, &T1;
+       *   - interval valid mask:
+       *       Mask &Valid;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane, typename Mask>
+        constexpr void Interval( const Lane *Org, const Lane *Dir, const Lane *InvDir, Lane &T0, Lane &T1, Mask &Valid ) const noexcept
+        {
+          const Lane Inf(std::numeric_limits<Type>::infinity());
+          Lane TB0, TB1, TS0, TS1, TA0, TA1, TC0, TC1;
+          Mask IsA, IsB;
+          const Mask IsBody = cylinder<Type>(A, B, Radius).template BodyInterval<Lane, Mask>(Org, Dir, TB0, TB1, TS0, TS1);
+
+          TB0 = Max(TB0, TS0);
+          TB1 = Min(TB1, TS1);
+          sphere<Type>(A, Radius).Interval(Org, Dir, InvDir, TA0, TA1, IsA);
+          sphere<Type>(B, Radius).Interval(Org, Dir, InvDir, TC0, TC1, IsB);
+
+          const Mask IsCyl = IsBody & (TB0 <= TB1);
+
+          T0 = Min(Select(IsCyl, TB0, Inf), Min(Select(IsA, TA0, Inf), Select(IsB, TC0, Inf)));
+          T1 = Max(Select(IsCyl, TB1, -Inf), Max(Select(IsA, TA1, -Inf), Select(IsB, TC1, -Inf)));
+          Valid = IsCyl | IsA | IsB;
+        } /* End of 'Interval' function */
+
+    }; /* End of 'capsule' class */
+
+  /* Intersect ray with shape function.
+   * ARGUMENTS:
+   *   - ray to intersect:
+   *       const ray<Type> &R;
+   *   - shape ('sphere', 'plane', 'disc', 'box', 'obox', 'cylinder' or 'capsule'):
+   *       const Shape &S;
+   * RETURNS:
+   *   (Type) distance to intersection (exit distance for origin inside shape, -1 if no intersection).
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, typename Shape>
+    constexpr Type Intersect( const ray<Type> &R, const Shape &S ) noexcept
+    {
+      const Type
+        Org[3] = {R.Org.X, R.Org.Y, R.Org.Z},
+        Dir[3] = {R.Dir.X, R.Dir.Y, R.Dir.Z},
+        InvDir[3] = {R.InvDir.X, R.InvDir.Y, R.InvDir.Z};
+      Type T0 = 0, T1 = 0;
+      bool Valid = false;
+
+      S.Interval(Org, Dir, InvDir, T0, T1, Valid);
+      return Valid && T1 >= 0 ? (T0 >= 0 ? T0 : T1) : -1;
+    } /* End of 'Intersect' function */
+
+  /* Intersect rays packet with shape function.
+   * ARGUMENTS:
+   *   - rays packet to intersect:
+   *       const ray_packet<Type, N> &R;
+   *   - shape ('sphere', 'plane', 'disc', 'box', 'obox', 'cylinder' or 'capsule'):
+   *       const Shape &S;
+   *   - lanes hit mask:
+   *       simd_mask<Type, N> &Hit;
+   * RETURNS:
+   *   (simd<Type, N>) distances to intersection (exit distances for origins inside shape, -1 if no intersection).
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N, typename Shape>
+    constexpr simd<Type, N> Intersect( const ray_packet<Type, N> &R, const Shape &S, simd_mask<Type, N> &Hit ) noexcept
+    {
+      simd<Type, N> T0, T1;
+      simd_mask<Type, N> Valid;
+
+      S.Interval(R.Org, R.Dir, R.InvDir, T0, T1, Valid);
+      Hit = Valid & (T1 >= simd<Type, N>(0));
+      return Select(Hit, Select(T0 >= simd<Type, N>(0), T0, T1), simd<Type, N>(-1));
+    } /* End of 'Intersect' function */
+
+  /* Closest intersection with homogeneous shapes array find function.
+   * ARGUMENTS:
+   *   - ray to intersect:
+   *       const ray<Type> &R;
+   *   - shapes array and its size:
+   *       const Shape *Shapes;
+   *       const int Count;
+   *   - closest distance (in: maximal distance, out: closest hit):
+   *       Type &T;
+   *   - closest shape index (updated on hit only):
+   *       int &Ind;
+   * RETURNS:
+   *   (bool) true if closer hit found.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, typename Shape>
+    constexpr bool IntersectShapes( const ray<Type> &R, const Shape *Shapes, const int Count, Type &T, int &Ind ) noexcept
+    {
+      bool IsFound = false;
+
+      for (int i = 0; i < Count; i++)
+      {
+        const Type Ti = Intersect(R, Shapes[i]);
+
+        if (Ti >= 0 && Ti < T)
+        {
+          T = Ti;
+          Ind = i;
+          IsFound = true;
+        }
+      }
+      return IsFound;
+    } /* End of 'IntersectShapes' function */
+
+  /* Closest intersection of rays packet with homogeneous shapes array find function.
+   * ARGUMENTS:
+   *   - rays packet to intersect:
+   *       const ray_packet<Type, N> &R;
+   *   - shapes array and its size:
+   *       const Shape *Shapes;
+   *       const int Count;
+   *   - lanes closest distances (in: maximal distances, out: closest hits):
+   *       simd<Type, N> &T;
+   *   - lanes closest shapes indices (updated for hit lanes only):
+   *       simd<int, N> &Ind;
+   * RETURNS:
+   *   (simd_mask<Type, N>) lanes which found closer hit mask.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N, typename Shape>
+    constexpr simd_mask<Type, N> IntersectShapes( const ray_packet<Type, N> &R, const Shape *Shapes, const int Count,
+                                                  simd<Type, N> &T, simd<int, N> &Ind ) noexcept
+    {
+      simd_mask<Type, N> Found(false);
+
+      for (int i = 0; i < Count; i++)
+      {
+        simd_mask<Type, N> Hit;
+        const simd<Type, N> Ti = Intersect(R, Shapes[i], Hit);
+        const simd_mask<Type, N> Closer = Hit & (Ti < T);
+
+        T = Select(Closer, Ti, T);
+        Ind = Select(Closer, simd<int, N>(i), Ind);
+        Found |= Closer;
+      }
+      return Found;
+    } /* End of 'IntersectShapes' function */
+
+  /* Occlusion query with homogeneous shapes array function (stops at first hit).
+   * Shape surface crossing (entry or exit) in distances range occludes ray.
+   * ARGUMENTS:
+   *   - ray to test:
+   *       const ray<Type> &R;
+   *   - shapes array and its size:
+   *       const Shape *Shapes;
+   *       const int Count;
+   *   - distances range [TMin, TMax] (negative TMin is same as 0):
+   *       const Type TMin, TMax;
+   * RETURNS:
+   *   (bool) true if ray is occluded.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, typename Shape>
+    constexpr bool Occluded( const ray<Type> &R, const Shape *Shapes, const int Count, const Type TMin, const Type TMax ) noexcept
+    {
+      const Type
+        Org[3] = {R.Org.X, R.Org.Y, R.Org.Z},
+        Dir[3] = {R.Dir.X, R.Dir.Y, R.Dir.Z},
+        InvDir[3] = {R.InvDir.X, R.InvDir.Y, R.InvDir.Z};
+
+      const Type Lo = Max(TMin, Type(0));
+
+      for (int i = 0; i < Count; i++)
+      {
+        Type T0 = 0, T1 = 0;
+        bool Valid = false;
+
+        Shapes[i].Interval(Org, Dir, InvDir, T0, T1, Valid);
+        if (Valid && ((T0 >= Lo && T0 <= TMax) || (T1 >= Lo && T1 <= TMax)))
+          return true;
+      }
+      return false;
+    } /* End of 'Occluded' function */
+
+  /* Rays packet occlusion query with homogeneous shapes array function.
+   * Query stops as soon as all active lanes are occluded.
+   * ARGUMENTS:
+   *   - rays packet to test:
+   *       const ray_packet<Type, N> &R;
+   *   - shapes array and its size:
+   *       const Shape *Shapes;
+   *       const int Count;
+   *   - lanes distances ranges [TMin, TMax] (negative TMin is same as 0):
+   *       const simd<Type, N> &TMin, &TMax;
+   *   - active lanes bits:
+   *       const UINT Active = ~0u;
+   * RETURNS:
+   *   (UINT) occluded lanes bits.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N, typename Shape>
+    constexpr UINT Occluded( const ray_packet<Type, N> &R, const Shape *Shapes, const int Count,
+                             const simd<Type, N> &TMin, const simd<Type, N> &TMax, const UINT Active = ~0u ) noexcept
+    {
+      const UINT All = Active & simd_mask<Type, N>(true).Bits();
+      const simd<Type, N> Lo = Max(TMin, simd<Type, N>(0));
+      simd_mask<Type, N> Occ(false);
+
+      for (int i = 0; i < Count; i++)
+      {
+        simd<Type, N> T0, T1;
+        simd_mask<Type, N> Valid;
+
+        Shapes[i].Interval(R.Org, R.Dir, R.InvDir, T0, T1, Valid);
+        Occ |= Valid & (((T0 >= Lo) & (T0 <= TMax)) | ((T1 >= Lo) & (T1 <= TMax)));
+        if ((Occ.Bits() & All) == All)
+          break;
+      }
+      return Occ.Bits() & All;
+    } /* End of 'Occluded' function */
+
+} /* end of 'mth' namespace */
+
+#endif /* __mth_shape_h_ */
+
+/* END OF 'mth_shape.h' FILE */
@@ -0,0 +1,1215 @@
+/***************************************************************
+ * FILE NAME   : mth_simd.h
+ * PURPOSE     : SIMD lanes pack class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_simd_h_
+#define __mth_simd_h_
+
+#include <bit>
+#include <type_traits>
+
+#include "mth_def.h"
+
+#if !defined(__CUDA__) && (defined(__AVX__) || defined(__AVX512F__))
+#include <immintrin.h>
+#define __MTH_SIMD_INTRIN__
+#endif /* __AVX__ */
+
+/* Math namespace */
+namespace mth
+{
+  /* Lane mask integer type (same width as number type) */
+  template<typename Type>
+    using simd_lane_int = std::conditional_t<sizeof(Type) == 8, long long, int>;
+
+  /* SIMD lanes mask class.
+   * Every lane holds 0 or all ones (as comparison instructions
+   * produce), so selects and mask logic stay single vector instructions.
+   */
+  template<typename Type, int N>
+    class alignas(sizeof(simd_lane_int<Type>) * N) simd_mask
+    {
+    public:
+      static const int SIZE = N;
+
+      simd_lane_int<Type> M[N]; // Lanes mask values
+
+      /* Class default constructor */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask( void ) = default;
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - value for all lanes:
+       *       const bool B;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask( const bool B ) noexcept
+      {
+        for (int i = 0; i < N; i++)
+          M[i] = -static_cast<simd_lane_int<Type>>(B);
+      } /* End of 'simd_mask' function */
+
+      /* Obtain mask from bits function.
+       * ARGUMENTS:
+       *   - lanes bits (bit i - lane i):
+       *       const UINT Bits;
+       * RETURNS:
+       *   (simd_mask) result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static simd_mask FromBits( const UINT Bits ) noexcept
+      {
+        simd_mask R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = -static_cast<simd_lane_int<Type>>((Bits >> i) & 1);
+        return R;
+      } /* End of 'FromBits' function */
+
+      /* Get lane mask function.
+       * ARGUMENTS:
+       *   - lane index:
+       *       const int Ind;
+       * RETURNS:
+       *   (bool) lane mask value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr bool operator[]( const int Ind ) const noexcept
+      {
+        return M[Ind] != 0;
+      } /* End of 'operator[]' function */
+
+      /* Set lane mask function.
+       * ARGUMENTS:
+       *   - lane index:
+       *       const int Ind;
+       *   - new lane value:
+       *       const bool B;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr void Set( const int Ind, const bool B ) noexcept
+      {
+        M[Ind] = -static_cast<simd_lane_int<Type>>(B);
+      } /* End of 'Set' function */
+
+      /* Masks conjunction function.
+       * ARGUMENTS:
+       *   - mask to combine with:
+       *       const simd_mask &B;
+       * RETURNS:
+       *   (simd_mask) result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask operator&( const simd_mask &B ) const noexcept
+      {
+        simd_mask R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = M[i] & B.M[i];
+        return R;
+      } /* End of 'operator&' function */
+
+      /* Masks disjunction function.
+       * ARGUMENTS:
+       *   - mask to combine with:
+       *       const simd_mask &B;
+       * RETURNS:
+       *   (simd_mask) result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask operator|( const simd_mask &B ) const noexcept
+      {
+        simd_mask R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = M[i] | B.M[i];
+        return R;
+      } /* End of 'operator|' function */
+
+      /* Masks exclusive disjunction function.
+       * ARGUMENTS:
+       *   - mask to combine with:
+       *       const simd_mask &B;
+       * RETURNS:
+       *   (simd_mask) result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask operator^( const simd_mask &B ) const noexcept
+      {
+        simd_mask R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = M[i] ^ B.M[i];
+        return R;
+      } /* End of 'operator^' function */
+
+      /* Mask negation function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (simd_mask) result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask operator~( void ) const noexcept
+      {
+        simd_mask R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = ~M[i];
+        return R;
+      } /* End of 'operator~' function */
+
+      /* Masks conjunction function.
+       * ARGUMENTS:
+       *   - mask to combine with:
+       *       const simd_mask &B;
+       * RETURNS:
+       *   (simd_mask &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask & operator&=( const simd_mask &B ) noexcept
+      {
+        return *this = *this & B;
+      } /* End of 'operator&=' function */
+
+      /* Masks disjunction function.
+       * ARGUMENTS:
+       *   - mask to combine with:
+       *       const simd_mask &B;
+       * RETURNS:
+       *   (simd_mask &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask & operator|=( const simd_mask &B ) noexcept
+      {
+        return *this = *this | B;
+      } /* End of 'operator|=' function */
+
+      /* Get lanes bits function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (UINT) lanes bits (bit i - lane i).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr UINT Bits( void ) const noexcept
+      {
+#ifdef __MTH_SIMD_INTRIN__
+        if (!std::is_constant_evaluated())
+        {
+#ifdef __AVX512F__
+          if constexpr (sizeof(Type) == 4 && N == 16)
+            return _mm512_cmplt_epi32_mask(_mm512_load_si512(M), _mm512_setzero_si512());
+          if constexpr (sizeof(Type) == 8 && N == 8)
+            return _mm512_cmplt_epi64_mask(_mm512_load_si512(M), _mm512_setzero_si512());
+#endif /* __AVX512F__ */
+          if constexpr (sizeof(Type) == 4 && N == 8)
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_load_si256(reinterpret_cast<const __m256i *>(M))));
+          if constexpr (sizeof(Type) == 8 && N == 4)
+            return _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_load_si256(reinterpret_cast<const __m256i *>(M))));
+          if constexpr (sizeof(Type) == 4 && N == 4)
+            return _mm_movemask_ps(_mm_castsi128_ps(_mm_load_si128(reinterpret_cast<const __m128i *>(M))));
+        }
+#endif /* __MTH_SIMD_INTRIN__ */
+        UINT R = 0;
+
+        for (int i = 0; i < N; i++)
+          R |= static_cast<UINT>(M[i] & 1) << i;
+        return R;
+      } /* End of 'Bits' function */
+
+      /* Check if any lane is set function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (bool) true if any lane set.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr bool Any( void ) const noexcept
+      {
+        return Bits() != 0;
+      } /* End of 'Any' function */
+
+      /* Check if all lanes are set function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (bool) true if all lanes set.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr bool All( void ) const noexcept
+      {
+        return Bits() == (1U << N) - 1;
+      } /* End of 'All' function */
+
+      /* Check if no lane is set function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (bool) true if no lane set.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr bool None( void ) const noexcept
+      {
+        return Bits() == 0;
+      } /* End of 'None' function */
+
+    }; /* End of 'simd_mask' class */
+
+  /* SIMD lanes pack class.
+   * Lanes are plain aligned array, every operation is fixed-length loop which
+   * compilers map to single vector instruction of target width (4, 8 or 16 lanes).
+   * Intrinsics are used only where compilers keep scalar code (square root, bits).
+   */
+  template<typename Type, int N>
+    class alignas(sizeof(Type) * N) simd
+    {
+      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in simd");
+      static_assert(N > 0 && N <= 16 && (N & (N - 1)) == 0, "Power of two lanes count (up to 16) is needed in simd");
+
+    public:
+      static const int SIZE = N;
+
+      Type V[N]; // Lanes values
+
+      /* Class default constructor */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd( void ) = default;
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - value for all lanes:
+       *       const Type A;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd( const Type A ) noexcept
+      {
+        for (int i = 0; i < N; i++)
+          V[i] = A;
+      } /* End of 'simd' function */
+
+      /* Class converting constructor.
+       * ARGUMENTS:
+       *   - lanes of other number type:
+       *       const simd<Type2, N> &S;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Type2>
+        constexpr explicit simd( const simd<Type2, N> &S ) noexcept
+        {
+          for (int i = 0; i < N; i++)
+            V[i] = static_cast<Type>(S.V[i]);
+        } /* End of 'simd' function */
+
+      /* Load lanes from memory function.
+       * ARGUMENTS:
+       *   - source array (N values):
+       *       const Type *P;
+       * RETURNS:
+       *   (simd) loaded lanes.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static simd Load( const Type *P ) noexcept
+      {
+        simd R;
+
+        for (int i = 0; i < N; i++)
+          R.V[i] = P[i];
+        return R;
+      } /* End of 'Load' function */
+
+      /* Load lanes from bytes array (e.g. quantized values) function.
+       * ARGUMENTS:
+       *   - source array (N values):
+       *       const unsigned char *P;
+       * RETURNS:
+       *   (simd) loaded lanes.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static simd LoadBytes( const unsigned char *P ) noexcept
+      {
+        simd R;
+
+#ifdef __MTH_SIMD_INTRIN__
+        if (!std::is_constant_evaluated())
+        {
+#ifdef __AVX512F__
+          if constexpr (std::is_same_v<Type, FLT> && N == 16)
+            return _mm512_store_ps(R.V, _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(P))))), R;
+          if constexpr (std::is_same_v<Type, DBL> && N == 8)
+            return _mm512_store_pd(R.V, _mm512_cvtepi32_pd(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(P))))), R;
+#endif /* __AVX512F__ */
+          if constexpr (std::is_same_v<Type, FLT> && N == 8)
+          {
+            const __m128i B = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(P));
+
+            return _mm256_store_ps(R.V, _mm256_cvtepi32_ps(_mm256_set_m128i(_mm_cvtepu8_epi32(_mm_srli_si128(B, 4)), _mm_cvtepu8_epi32(B)))), R;
+          }
+          if constexpr (std::is_same_v<Type, DBL> && N == 4)
+            return _mm256_store_pd(R.V, _mm256_cvtepi32_pd(_mm_cvtepu8_epi32(_mm_loadu_si32(P)))), R;
+          if constexpr (std::is_same_v<Type, FLT> && N == 4)
+            return _mm_store_ps(R.V, _mm_cvtepi32_ps(_mm_cvtepu8_epi32(_mm_loadu_si32(P)))), R;
+        }
+#endif /* __MTH_SIMD_INTRIN__ */
+        for (int i = 0; i < N; i++)
+          R.V[i] = static_cast<Type>(P[i]);
+        return R;
+      } /* End of 'LoadBytes' function */
+
+      /* Get lanes index sequence {0, 1, ..., N - 1} function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (simd) lanes indices.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static simd Index( void ) noexcept
+      {
+        simd R;
+
+        for (int i = 0; i < N; i++)
+          R.V[i] = static_cast<Type>(i);
+        return R;
+      } /* End of 'Index' function */
+
+      /* Store lanes to memory function.
+       * ARGUMENTS:
+       *   - destination array (N values):
+       *       Type *P;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr void Store( Type *P ) const noexcept
+      {
+        for (int i = 0; i < N; i++)
+          P[i] = V[i];
+      } /* End of 'Store' function */
+
+      /* Lane getter function.
+       * ARGUMENTS:
+       *   - lane index:
+       *       const int Ind;
+       * RETURNS:
+       *   (Type) lane value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type operator[]( const int Ind ) const noexcept
+      {
+        return V[Ind];
+      } /* End of 'operator[]' function */
+
+      /* Lane setter function.
+       * ARGUMENTS:
+       *   - lane index:
+       *       const int Ind;
+       * RETURNS:
+       *   (Type &) lane reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type & operator[]( const int Ind ) noexcept
+      {
+        return V[Ind];
+      } /* End of 'operator[]' function */
+
+      /* Add lanes function.
+       * ARGUMENTS:
+       *   - lanes to add:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd) result lanes.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd operator+( const simd &S ) const noexcept
+      {
+        simd R;
+
+        for (int i = 0; i < N; i++)
+          R.V[i] = V[i] + S.V[i];
+        return R;
+      } /* End of 'operator+' function */
+
+      /* Subtract lanes function.
+       * ARGUMENTS:
+       *   - lanes to subtract:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd) result lanes.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd operator-( const simd &S ) const noexcept
+      {
+        simd R;
+
+        for (int i = 0; i < N; i++)
+          R.V[i] = V[i] - S.V[i];
+        return R;
+      } /* End of 'operator-' function */
+
+      /* Multiply lanes function.
+       * ARGUMENTS:
+       *   - lanes to multiply by:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd) result lanes.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd operator*( const simd &S ) const noexcept
+      {
+        simd R;
+
+        for (int i = 0; i < N; i++)
+          R.V[i] = V[i] * S.V[i];
+        return R;
+      } /* End of 'operator*' function */
+
+      /* Divide lanes function.
+       * ARGUMENTS:
+       *   - lanes to divide by:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd) result lanes.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd operator/( const simd &S ) const noexcept
+      {
+        simd R;
+
+        for (int i = 0; i < N; i++)
+          R.V[i] = V[i] / S.V[i];
+        return R;
+      } /* End of 'operator/' function */
+
+      /* Negate lanes function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (simd) result lanes.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd operator-( void ) const noexcept
+      {
+        simd R;
+
+        for (int i = 0; i < N; i++)
+          R.V[i] = -V[i];
+        return R;
+      } /* End of 'operator-' function */
+
+      /* Add lanes to current function.
+       * ARGUMENTS:
+       *   - lanes to add:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd & operator+=( const simd &S ) noexcept
+      {
+        for (int i = 0; i < N; i++)
+          V[i] += S.V[i];
+        return *this;
+      } /* End of 'operator+=' function */
+
+      /* Subtract lanes from current function.
+       * ARGUMENTS:
+       *   - lanes to subtract:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd & operator-=( const simd &S ) noexcept
+      {
+        for (int i = 0; i < N; i++)
+          V[i] -= S.V[i];
+        return *this;
+      } /* End of 'operator-=' function */
+
+      /* Multiply current lanes function.
+       * ARGUMENTS:
+       *   - lanes to multiply by:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd & operator*=( const simd &S ) noexcept
+      {
+        for (int i = 0; i < N; i++)
+          V[i] *= S.V[i];
+        return *this;
+      } /* End of 'operator*=' function */
+
+      /* Divide current lanes function.
+       * ARGUMENTS:
+       *   - lanes to divide by:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd & operator/=( const simd &S ) noexcept
+      {
+        for (int i = 0; i < N; i++)
+          V[i] /= S.V[i];
+        return *this;
+      } /* End of 'operator/=' function */
+
+      /* Lanes bitwise and function (integer lanes only).
+       * ARGUMENTS:
+       *   - lanes to combine with:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd) result lanes.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd operator&( const simd &S ) const noexcept requires std::is_integral_v<Type>
+      {
+        simd R;
+
+        for (int i = 0; i < N; i++)
+          R.V[i] = V[i] & S.V[i];
+        return R;
+      } /* End of 'operator&' function */
+
+      /* Lanes less comparison function.
+       * ARGUMENTS:
+       *   - lanes to compare with:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd_mask<Type, N>) comparison result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> operator<( const simd &S ) const noexcept
+      {
+        simd_mask<Type, N> R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = -static_cast<simd_lane_int<Type>>(V[i] < S.V[i]);
+        return R;
+      } /* End of 'operator<' function */
+
+      /* Lanes less or equal comparison function.
+       * ARGUMENTS:
+       *   - lanes to compare with:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd_mask<Type, N>) comparison result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> operator<=( const simd &S ) const noexcept
+      {
+        simd_mask<Type, N> R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = -static_cast<simd_lane_int<Type>>(V[i] <= S.V[i]);
+        return R;
+      } /* End of 'operator<=' function */
+
+      /* Lanes greater comparison function.
+       * ARGUMENTS:
+       *   - lanes to compare with:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd_mask<Type, N>) comparison result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> operator>( const simd &S ) const noexcept
+      {
+        simd_mask<Type, N> R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = -static_cast<simd_lane_int<Type>>(V[i] > S.V[i]);
+        return R;
+      } /* End of 'operator>' function */
+
+      /* Lanes greater or equal comparison function.
+       * ARGUMENTS:
+       *   - lanes to compare with:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd_mask<Type, N>) comparison result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> operator>=( const simd &S ) const noexcept
+      {
+        simd_mask<Type, N> R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = -static_cast<simd_lane_int<Type>>(V[i] >= S.V[i]);
+        return R;
+      } /* End of 'operator>=' function */
+
+      /* Lanes equality comparison function.
+       * ARGUMENTS:
+       *   - lanes to compare with:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd_mask<Type, N>) comparison result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> operator==( const simd &S ) const noexcept
+      {
+        simd_mask<Type, N> R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = -static_cast<simd_lane_int<Type>>(V[i] == S.V[i]);
+        return R;
+      } /* End of 'operator==' function */
+
+      /* Lanes inequality comparison function.
+       * ARGUMENTS:
+       *   - lanes to compare with:
+       *       const simd &S;
+       * RETURNS:
+       *   (simd_mask<Type, N>) comparison result mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> operator!=( const simd &S ) const noexcept
+      {
+        simd_mask<Type, N> R;
+
+        for (int i = 0; i < N; i++)
+          R.M[i] = -static_cast<simd_lane_int<Type>>(V[i] != S.V[i]);
+        return R;
+      } /* End of 'operator!=' function */
+
+      /* Get lanes minimal value function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (Type) minimal lane value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type MinC( void ) const noexcept
+      {
+        Type R = V[0];
+
+        for (int i = 1; i < N; i++)
+          R = V[i] < R ? V[i] : R;
+        return R;
+      } /* End of 'MinC' function */
+
+      /* Get lanes maximal value function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (Type) maximal lane value.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type MaxC( void ) const noexcept
+      {
+        Type R = V[0];
+
+        for (int i = 1; i < N; i++)
+          R = V[i] > R ? V[i] : R;
+        return R;
+      } /* End of 'MaxC' function */
+
+      /* Get lanes sum function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (Type) lanes values sum.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Sum( void ) const noexcept
+      {
+        Type R = 0;
+
+        for (int i = 0; i < N; i++)
+          R += V[i];
+        return R;
+      } /* End of 'Sum' function */
+
+    }; /* End of 'simd' class */
+
+  /* Lanes select by mask function.
+   * ARGUMENTS:
+   *   - lanes mask (of any lanes number type):
+   *       const simd_mask<MaskType, N> &M;
+   *   - lanes for set mask lanes:
+   *       const simd<Type, N> &A;
+   *   - lanes for unset mask lanes:
+   *       const simd<Type, N> &B;
+   * RETURNS:
+   *   (simd<Type, N>) result lanes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, typename MaskType, int N>
+    constexpr simd<Type, N> Select( const simd_mask<MaskType, N> &M, const simd<Type, N> &A, const simd<Type, N> &B ) noexcept
+    {
+      simd<Type, N> R;
+
+      for (int i = 0; i < N; i++)
+        R.V[i] = M.M[i] ? A.V[i] : B.V[i];
+      return R;
+    } /* End of 'Select' function */
+
+  /* Lanes minimum function.
+   * ARGUMENTS:
+   *   - lanes to compare:
+   *       const simd<Type, N> &A, &B;
+   * RETURNS:
+   *   (simd<Type, N>) result lanes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N>
+    constexpr simd<Type, N> Min( const simd<Type, N> &A, const simd<Type, N> &B ) noexcept
+    {
+      simd<Type, N> R;
+
+      for (int i = 0; i < N; i++)
+        R.V[i] = A.V[i] < B.V[i] ? A.V[i] : B.V[i];
+      return R;
+    } /* End of 'Min' function */
+
+  /* Lanes maximum function.
+   * ARGUMENTS:
+   *   - lanes to compare:
+   *       const simd<Type, N> &A, &B;
+   * RETURNS:
+   *   (simd<Type, N>) result lanes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N>
+    constexpr simd<Type, N> Max( const simd<Type, N> &A, const simd<Type, N> &B ) noexcept
+    {
+      simd<Type, N> R;
+
+      for (int i = 0; i < N; i++)
+        R.V[i] = A.V[i] > B.V[i] ? A.V[i] : B.V[i];
+      return R;
+    } /* End of 'Max' function */
+
+  /* Lanes absolute value function.
+   * ARGUMENTS:
+   *   - source lanes:
+   *       const simd<Type, N> &A;
+   * RETURNS:
+   *   (simd<Type, N>) result lanes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N>
+    constexpr simd<Type, N> Abs( const simd<Type, N> &A ) noexcept
+    {
+      simd<Type, N> R;
+
+      for (int i = 0; i < N; i++)
+        R.V[i] = A.V[i] < 0 ? -A.V[i] : A.V[i];
+      return R;
+    } /* End of 'Abs' function */
+
+  /* Lanes flooring function.
+   * ARGUMENTS:
+   *   - source lanes:
+   *       const simd<Type, N> &A;
+   * RETURNS:
+   *   (simd<Type, N>) result lanes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N>
+    constexpr simd<Type, N> Floor( const simd<Type, N> &A ) noexcept
+    {
+      simd<Type, N> R;
+
+#ifdef __MTH_SIMD_INTRIN__
+      if (!std::is_constant_evaluated())
+      {
+#ifdef __AVX512F__
+        if constexpr (std::is_same_v<Type, FLT> && N == 16)
+          return _mm512_store_ps(R.V, _mm512_roundscale_ps(_mm512_load_ps(A.V), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)), R;
+        if constexpr (std::is_same_v<Type, DBL> && N == 8)
+          return _mm512_store_pd(R.V, _mm512_roundscale_pd(_mm512_load_pd(A.V), _MM_FROUND_TO_NEG_INF | _MM_FROUND_NO_EXC)), R;
+#endif /* __AVX512F__ */
+        if constexpr (std::is_same_v<Type, FLT> && N == 8)
+          return _mm256_store_ps(R.V, _mm256_floor_ps(_mm256_load_ps(A.V))), R;
+        if constexpr (std::is_same_v<Type, DBL> && N == 4)
+          return _mm256_store_pd(R.V, _mm256_floor_pd(_mm256_load_pd(A.V))), R;
+        if constexpr (std::is_same_v<Type, FLT> && N == 4)
+          return _mm_store_ps(R.V, _mm_floor_ps(_mm_load_ps(A.V))), R;
+      }
+#endif /* __MTH_SIMD_INTRIN__ */
+      for (int i = 0; i < N; i++)
+        R.V[i] = std::floor(A.V[i]);
+      return R;
+    } /* End of 'Floor' function */
+
+  /* Lanes square root function.
+   * ARGUMENTS:
+   *   - source lanes:
+   *       const simd<Type, N> &A;
+   * RETURNS:
+   *   (simd<Type, N>) result lanes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N>
+    constexpr simd<Type, N> Sqrt( const simd<Type, N> &A ) noexcept
+    {
+      simd<Type, N> R;
+
+#ifdef __MTH_SIMD_INTRIN__
+      if (!std::is_constant_evaluated())
+      {
+#ifdef __AVX512F__
+        if constexpr (std::is_same_v<Type, FLT> && N == 16)
+          return _mm512_store_ps(R.V, _mm512_sqrt_ps(_mm512_load_ps(A.V))), R;
+        if constexpr (std::is_same_v<Type, DBL> && N == 8)
+          return _mm512_store_pd(R.V, _mm512_sqrt_pd(_mm512_load_pd(A.V))), R;
+#endif /* __AVX512F__ */
+        if constexpr (std::is_same_v<Type, FLT> && N == 8)
+          return _mm256_store_ps(R.V, _mm256_sqrt_ps(_mm256_load_ps(A.V))), R;
+        if constexpr (std::is_same_v<Type, DBL> && N == 4)
+          return _mm256_store_pd(R.V, _mm256_sqrt_pd(_mm256_load_pd(A.V))), R;
+        if constexpr (std::is_same_v<Type, FLT> && N == 4)
+          return _mm_store_ps(R.V, _mm_sqrt_ps(_mm_load_ps(A.V))), R;
+      }
+#endif /* __MTH_SIMD_INTRIN__ */
+      for (int i = 0; i < N; i++)
+        R.V[i] = std::sqrt(A.V[i]);
+      return R;
+    } /* End of 'Sqrt' function */
+
+  /* Lanes cube root function.
+   * Exponent thirds bits estimate is refined by Halley iterations
+   * (2 for float, 3 for double), no branches per lane.
+   * Zero, infinite and NaN lanes are passed through (as std::cbrt does).
+   * ARGUMENTS:
+   *   - source lanes:
+   *       const simd<Type, N> &A;
+   * RETURNS:
+   *   (simd<Type, N>) cube roots.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N>
+    constexpr simd<Type, N> Cbrt( const simd<Type, N> &A ) noexcept
+    {
+      const simd<Type, N> X = Abs(A);
+      simd<Type, N> R;
+
+      /* Estimate uses high 32 bits only, so division stays in vector registers */
+      for (int i = 0; i < N; i++)
+        if constexpr (sizeof(Type) == 8)
+          R.V[i] = std::bit_cast<Type>(static_cast<unsigned long long>(
+            static_cast<UINT>(std::bit_cast<unsigned long long>(X.V[i]) >> 32) / 3 + 0x2A9F7893U) << 32);
+        else
+          R.V[i] = std::bit_cast<Type>(std::bit_cast<UINT>(X.V[i]) / 3 + 0x2A5137A0U);
+      for (int k = 0; k < (sizeof(Type) == 8 ? 3 : 2); k++)
+      {
+        const simd<Type, N> R3 = R * R * R;
+
+        R *= (R3 + X + X) / (R3 + R3 + X);
+      }
+      /* Zeros, infinities and NaNs are their own cube roots */
+      const simd_mask<Type, N> IsRefined = (X > simd<Type, N>(0)) & (X < simd<Type, N>(std::numeric_limits<Type>::infinity()));
+
+      return Select(IsRefined, Select(A < simd<Type, N>(0), -R, R), A);
+    } /* End of 'Cbrt' function */
+
+  /* Lanes gather function.
+   * ARGUMENTS:
+   *   - base array pointer:
+   *       const Type *Base;
+   *   - lanes indices:
+   *       const simd<int, N> &Ind;
+   * RETURNS:
+   *   (simd<Type, N>) gathered lanes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type, int N>
+    constexpr simd<Type, N> Gather( const Type *Base, const simd<int, N> &Ind ) noexcept
+    {
+      simd<Type, N> R;
+
+#if defined(__MTH_SIMD_INTRIN__) && defined(__AVX2__)
+      if (!std::is_constant_evaluated())
+      {
+#ifdef __AVX512F__
+        if constexpr (std::is_same_v<Type, FLT> && N == 16)
+          return _mm512_store_ps(R.V, _mm512_i32gather_ps(_mm512_load_si512(Ind.V), Base, 4)), R;
+        if constexpr (std::is_same_v<Type, DBL> && N == 8)
+          return _mm512_store_pd(R.V, _mm512_i32gather_pd(_mm256_load_si256(reinterpret_cast<const __m256i *>(Ind.V)), Base, 8)), R;
+#endif /* __AVX512F__ */
+        if constexpr (std::is_same_v<Type, FLT> && N == 8)
+          return _mm256_store_ps(R.V, _mm256_i32gather_ps(Base, _mm256_load_si256(reinterpret_cast<const __m256i *>(Ind.V)), 4)), R;
+        if constexpr (std::is_same_v<Type, DBL> && N == 4)
+          return _mm256_store_pd(R.V, _mm256_i32gather_pd(Base, _mm_load_si128(reinterpret_cast<const __m128i *>(Ind.V)), 8)), R;
+        if constexpr (std::is_same_v<Type, FLT> && N == 4)
+          return _mm_store_ps(R.V, _mm_i32gather_ps(Base, _mm_load_si128(reinterpret_cast<const __m128i *>(Ind.V)), 4)), R;
+      }
+#endif /* __AVX2__ */
+      for (int i = 0; i < N; i++)
+        R.V[i] = Base[Ind.V[i]];
+      return R;
+    } /* End of 'Gather' function */
+
+  /* Lanes gather from bytes table function.
+   * Intrinsic path gathers 4 byte words holding indexed bytes (words are
+   * aligned to 4 from table start, so table size must be multiple of 4).
+   * ARGUMENTS:
+   *   - bytes table pointer:
+   *       const BYTE *Base;
+   *   - lanes indices:
+   *       const simd<int, N> &Ind;
+   * RETURNS:
+   *   (simd<int, N>) gathered bytes.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<int N>
+    constexpr simd<int, N> Gather( const BYTE *Base, const simd<int, N> &Ind ) noexcept
+    {
+      simd<int, N> R;
+
+#if defined(__MTH_SIMD_INTRIN__) && defined(__AVX2__)
+      if (!std::is_constant_evaluated())
+      {
+#ifdef __AVX512F__
+        if constexpr (N == 16)
+        {
+          const __m512i I = _mm512_load_si512(Ind.V), Low = _mm512_set1_epi32(3);
+          const __m512i W = _mm512_i32gather_epi32(_mm512_andnot_si512(Low, I), Base, 1);
+
+          return _mm512_store_si512(R.V, _mm512_and_si512(_mm512_srlv_epi32(W, _mm512_slli_epi32(_mm512_and_si512(I, Low), 3)), _mm512_set1_epi32(0xFF))), R;
+        }
+#endif /* __AVX512F__ */
+        if constexpr (N == 8)
+        {
+          const __m256i I = _mm256_load_si256(reinterpret_cast<const __m256i *>(Ind.V)), Low = _mm256_set1_epi32(3);
+          const __m256i W = _mm256_i32gather_epi32(reinterpret_cast<const int *>(Base), _mm256_andnot_si256(Low, I), 1);
+
+          return _mm256_store_si256(reinterpret_cast<__m256i *>(R.V),
+            _mm256_and_si256(_mm256_srlv_epi32(W, _mm256_slli_epi32(_mm256_and_si256(I, Low), 3)), _mm256_set1_epi32(0xFF))), R;
+        }
+        if constexpr (N == 4)
+        {
+          const __m128i I = _mm_load_si128(reinterpret_cast<const __m128i *>(Ind.V)), Low = _mm_set1_epi32(3);
+          const __m128i W = _mm_i32gather_epi32(reinterpret_cast<const int *>(Base), _mm_andnot_si128(Low, I), 1);
+
+          return _mm_store_si128(reinterpret_cast<__m128i *>(R.V),
+            _mm_and_si128(_mm_srlv_epi32(W, _mm_slli_epi32(_mm_and_si128(I, Low), 3)), _mm_set1_epi32(0xFF))), R;
+        }
+      }
+#endif /* __AVX2__ */
+      for (int i = 0; i < N; i++)
+        R.V[i] = Base[Ind.V[i]];
+      return R;
+    } /* End of 'Gather' function */
+
+  /* Number select by flag function (scalar lane pair of 'Select').
+   * ARGUMENTS:
+   *   - flag:
+   *       const bool M;
+   *   - numbers to select from:
+   *       const Type A, B;
+   * RETURNS:
+   *   (Type) A if flag set, B otherwise.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type>
+    constexpr Type Select( const bool M, const Type A, const Type B ) noexcept
+    {
+      return M ? A : B;
+    } /* End of 'Select' function */
+
+  /* Number minimum function (scalar lane pair of 'Min').
+   * ARGUMENTS:
+   *   - numbers to compare:
+   *       const Type A, B;
+   * RETURNS:
+   *   (Type) minimal number.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type>
+    constexpr std::enable_if_t<std::is_arithmetic_v<Type>, Type> Min( const Type A, const Type B ) noexcept
+    {
+      return A < B ? A : B;
+    } /* End of 'Min' function */
+
+  /* Number maximum function (scalar lane pair of 'Max').
+   * ARGUMENTS:
+   *   - numbers to compare:
+   *       const Type A, B;
+   * RETURNS:
+   *   (Type) maximal number.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type>
+    constexpr std::enable_if_t<std::is_arithmetic_v<Type>, Type> Max( const Type A, const Type B ) noexcept
+    {
+      return A > B ? A : B;
+    } /* End of 'Max' function */
+
+  /* Number absolute value function (scalar lane pair of 'Abs').
+   * ARGUMENTS:
+   *   - source number:
+   *       const Type A;
+   * RETURNS:
+   *   (Type) absolute value.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type>
+    constexpr std::enable_if_t<std::is_arithmetic_v<Type>, Type> Abs( const Type A ) noexcept
+    {
+      return A < 0 ? -A : A;
+    } /* End of 'Abs' function */
+
+  /* Number square root function (scalar lane pair of 'Sqrt').
+   * ARGUMENTS:
+   *   - source number:
+   *       const Type A;
+   * RETURNS:
+   *   (Type) square root.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type>
+    constexpr std::enable_if_t<std::is_arithmetic_v<Type>, Type> Sqrt( const Type A ) noexcept
+    {
+      if constexpr (std::is_same_v<Type, FLT>)
+        return sqrtf(A);
+      else
+        return sqrt(A);
+    } /* End of 'Sqrt' function */
+
+  /* Number flooring function (scalar lane pair of 'Floor').
+   * ARGUMENTS:
+   *   - source number:
+   *       const Type A;
+   * RETURNS:
+   *   (Type) greatest integer number not above A.
+   */
+#ifdef __CUDA__
+  __host__ __device__
+#endif /* __CUDA__ */
+  template<typename Type>
+    constexpr std::enable_if_t<std::is_arithmetic_v<Type>, Type> Floor( const Type A ) noexcept
+    {
+      return std::floor(A);
+    } /* End of 'Floor' function */
+
+  /* Integer lanes type of same lanes count ('int' for scalar lane, 'simd<int, N>' for 'simd<Type, N>') */
+  template<typename Lane>
+    struct simd_int_traits
+    {
+      using type = int;
+    }; /* End of 'simd_int_traits' structure */
+  template<typename Type, int N>
+    struct simd_int_traits<simd<Type, N>>
+    {
+      using type = simd<int, N>;
+    }; /* End of 'simd_int_traits' structure */
+  template<typename Lane>
+    using simd_int = typename simd_int_traits<Lane>::type;
+
+} /* end of 'mth' namespace */
+
+#endif /* __mth_simd_h_ */
+
+/* END OF 'mth_simd.h' FILE */
@@ -1,17 +1,34 @@
 /***************************************************************
  * FILE NAME   : mth_solver.h
  * PURPOSE     : Equations solver module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_solver_h_
 #define __mth_solver_h_
 
+#include <atomic>
+#include <limits>
+
 #include "mth_def.h"
+#include "mth_simd.h"
+#include "mth_dual.h"
+#include "mth_matn.h"
+#include "mth_parallel.h"
 
 /* Math namespace */
 namespace mth
 {
+  /* Forward declaration */
+  template<typename Type>
+    class vec2;
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class matr;
+  template<typename Type>
+    class quat;
+
   /* Solver class */
   class solver
   {
@@ -91,6 +108,7 @@ namespace mth
       {
         SquareSolver(B, C, D, S);
         S[2] = S[1];
+        return;
       }
 
       const DBL
@@ -125,6 +143,947 @@ namespace mth
       }
     } /* End of 'CubicSolver' function */
 
+    /* Quartic equation solver.
+     * ARGUMENTS:
+     *   - koefficent solver:
+     *       const DBL A, B, C, D, E;
+     *   - 4 number solver (ascending, NaN past roots count):
+     *       DBL *S;
+     * RETURNS:
+     *   (int) number of real roots.
+     */
+  #ifdef __CUDA__
+    __host__ __device__
+  #endif /* __CUDA__ */
+    constexpr static int QuarticSolver( const DBL A, const DBL B, const DBL C, const DBL D, const DBL E, DBL *S ) noexcept
+    {
+      /* Single lane run of lanes solver, so both give the same roots */
+      simd<DBL, 1> R[4];
+      const int Count = QuarticSolver(simd<DBL, 1>(A), simd<DBL, 1>(B), simd<DBL, 1>(C), simd<DBL, 1>(D), simd<DBL, 1>(E), R)[0];
+
+      for (int i = 0; i < 4; i++)
+        S[i] = R[i][0];
+      return Count;
+    } /* End of 'QuarticSolver' function */
+
+  private:
+    /* Lanes arc cosine approximation (Abramowitz-Stegun 4.4.46, error below 2e-8) function.
+     * ARGUMENTS:
+     *   - cosine lanes in [-1, 1]:
+     *       const simd<Type, N> &X;
+     * RETURNS:
+     *   (simd<Type, N>) angle lanes in [0, pi].
+     */
+#ifdef __CUDA__
+    __host__ __device__
+#endif /* __CUDA__ */
+    template<typename Type, int N>
+      constexpr static simd<Type, N> LanesAcos( const simd<Type, N> &X ) noexcept
+      {
+        constexpr Type K[] =
+        {
+          -0.0012624911, 0.0066700901, -0.0170881256, 0.0308918810,
+          -0.0501743046, 0.0889789874, -0.2145988016, 1.5707963050
+        };
+        const simd<Type, N> Ax = Abs(X);
+        simd<Type, N> P(K[0]);
+
+        for (int i = 1; i < 8; i++)
+          P = P * Ax + simd<Type, N>(K[i]);
+        P *= Sqrt(simd<Type, N>(1) - Ax);
+        return Select(X < simd<Type, N>(0), simd<Type, N>(static_cast<Type>(PI)) - P, P);
+      } /* End of 'LanesAcos' function */
+
+  public:
+    /* Batched solvers work on SIMD lanes (one equation per lane): every
+     * discriminant branch is evaluated for all lanes and results are
+     * selected by masks. Roots go in ascending order, slots past root
+     * count are NaN (so distance comparisons with them fail).
+     */
+
+    /* Lanes square equation solver.
+     * ARGUMENTS:
+     *   - equations A * x^2 + B * x + C = 0 coefficients:
+     *       const simd<Type, N> &A, &B, &C;
+     *   - 2 roots lanes:
+     *       simd<Type, N> *S;
+     * RETURNS:
+     *   (simd<int, N>) number of distinct real roots (0, 1 or 2).
+     */
+#ifdef __CUDA__
+    __host__ __device__
+#endif /* __CUDA__ */
+    template<typename Type, int N>
+      constexpr static simd<int, N> SquareSolver( const simd<Type, N> &A, const simd<Type, N> &B, const simd<Type, N> &C, simd<Type, N> *S ) noexcept
+      {
+        using lanes = simd<Type, N>;
+        const lanes Zero(0), One(1), NaN(std::numeric_limits<Type>::quiet_NaN());
+        const auto IsLinear = A == Zero;
+
+        /* Linear case */
+        const auto LinearRoot = B != Zero;
+        const lanes Lin = -C / Select(LinearRoot, B, One);
+
+        /* Square case (cancellation free form) */
+        const lanes
+          D = B * B - A * C * lanes(4),
+          SqrtD = Sqrt(Max(D, Zero)),
+          Q = (B + Select(B < Zero, -SqrtD, SqrtD)) * lanes(-0.5),
+          R0 = Q / Select(IsLinear, One, A),
+          R1 = Select(Q != Zero, C / Select(Q != Zero, Q, One), R0);
+
+        const auto
+          Two = ~IsLinear & (D > Zero),
+          OneRoot = Select(IsLinear, lanes(Select(LinearRoot, One, Zero)), Select(D == Zero, One, Zero)) != Zero;
+
+        S[0] = Select(Two, Min(R0, R1), Select(OneRoot, Select(IsLinear, Lin, R0), NaN));
+        S[1] = Select(Two, Max(R0, R1), NaN);
+        return simd<int, N>(Select(Two, lanes(2), Select(OneRoot, One, Zero)));
+      } /* End of 'SquareSolver' function */
+
+    /* Lanes cubic equation solver.
+     * Three real roots case uses polynomial arc cosine and sine/cosine
+     * of third angle (all roots from one angle), then roots are polished
+     * by one guarded Newton step.
+     * ARGUMENTS:
+     *   - equations A * x^3 + B * x^2 + C * x + D = 0 coefficients:
+     *       const simd<Type, N> &A, &B, &C, &D;
+     *   - 3 roots lanes:
+     *       simd<Type, N> *S;
+     * RETURNS:
+     *   (simd<int, N>) number of distinct real roots (0 to 3).
+     */
+#ifdef __CUDA__
+    __host__ __device__
+#endif /* __CUDA__ */
+    template<typename Type, int N>
+      constexpr static simd<int, N> CubicSolver( const simd<Type, N> &A, const simd<Type, N> &B, const simd<Type, N> &C, const simd<Type, N> &D, simd<Type, N> *S ) noexcept
+      {
+        using lanes = simd<Type, N>;
+        const lanes Zero(0), One(1), Half(0.5), Third(static_cast<Type>(1.0 / 3)), NaN(std::numeric_limits<Type>::quiet_NaN());
+        const auto IsSquare = A == Zero;
+
+        /* Degenerate lanes */
+        lanes Sq[2];
+        const simd<int, N> SqCount = SquareSolver(B, C, D, Sq);
+
+        /* Depressed cubic t^3 + p * t + q = 0, x = t - Shift */
+        const lanes
+          RevA = One / Select(IsSquare, One, A),
+          a = B * RevA, b = C * RevA, c = D * RevA,
+          Shift = a * Third,
+          p = b - a * Shift,
+          q = (lanes(2.0 / 27) * a * a - Third * b) * a + c,
+          Disc = p * p * p * lanes(1.0 / 27) + q * q * lanes(0.25);
+
+        /* One real root (stable Cardano form) */
+        const lanes
+          G = Sqrt(Max(Disc, Zero)),
+          U = Cbrt(q * -Half - Select(q < Zero, -G, G)),
+          T1 = U + Select(U != Zero, -p * Third / Select(U != Zero, U, One), Zero);
+
+        /* Double root */
+        const lanes
+          W = Cbrt(q * -Half),
+          T2a = Min(W + W, -W),
+          T2b = Max(W + W, -W);
+
+        /* Three real roots (trigonometric form) */
+        const lanes
+          M = Sqrt(Max(-p * Third, Zero)),
+          Cos3 = Max(Min(q * -Half / Select(M != Zero, M * M * M, One), One), -One),
+          Theta = LanesAcos(Cos3) * Third,
+          Theta2 = Theta * Theta;
+        constexpr Type
+          CosK[] = {1.0 / 479001600, -1.0 / 3628800, 1.0 / 40320, -1.0 / 720, 1.0 / 24, -0.5, 1},
+          SinK[] = {1.0 / 6227020800, -1.0 / 39916800, 1.0 / 362880, -1.0 / 5040, 1.0 / 120, -1.0 / 6, 1};
+        lanes Cs(CosK[0]), Sn(SinK[0]);
+
+        /* Taylor series are enough for angle in [0, pi / 3] */
+        for (int i = 1; i < 7; i++)
+        {
+          Cs = Cs * Theta2 + lanes(CosK[i]);
+          Sn = Sn * Theta2 + lanes(SinK[i]);
+        }
+        Sn *= Theta;
+
+        const lanes
+          Sqrt3Sn = lanes(1.7320508075688772) * Sn,
+          T3[3] = {M * (-Cs - Sqrt3Sn), M * (Sqrt3Sn - Cs), M * (Cs + Cs)};
+
+        /* Select by discriminant sign */
+        const auto
+          IsOne = Disc > Zero,
+          IsDouble = Disc == Zero,
+          IsTriple = IsDouble & (p == Zero);
+        lanes T[3] =
+        {
+          Select(IsOne, T1, Select(IsDouble, T2a, T3[0])),
+          Select(IsOne | IsTriple, NaN, Select(IsDouble, T2b, T3[1])),
+          Select(IsOne | IsDouble, NaN, T3[2])
+        };
+
+        for (int i = 0; i < 3; i++)
+        {
+          /* Guarded Newton polish */
+          const lanes
+            F = (T[i] * T[i] + p) * T[i] + q,
+            Df = lanes(3) * T[i] * T[i] + p,
+            Tn = T[i] - F / Select(Df != Zero, Df, One),
+            Fn = (Tn * Tn + p) * Tn + q;
+
+          T[i] = Select((Df != Zero) & (Abs(Fn) < Abs(F)), Tn, T[i]);
+          S[i] = Select(IsSquare, i < 2 ? Sq[i] : NaN, T[i] - Shift);
+        }
+
+        return simd<int, N>(Select(IsSquare, lanes(SqCount), Select(IsOne | IsTriple, One, Select(IsDouble, lanes(2), lanes(3)))));
+      } /* End of 'CubicSolver' function */
+
+    /* Lanes quartic equation solver (Ferrari-Descartes).
+     * Depressed quartic y^4 + p * y^2 + q * y + r = 0 is split to two
+     * quadratics by largest root of resolvent cubic (lanes 'CubicSolver'),
+     * biquadratic lanes (q = 0) are solved directly. Roots are polished by
+     * two guarded Newton steps on depressed quartic.
+     * ARGUMENTS:
+     *   - equations A * x^4 + B * x^3 + C * x^2 + D * x + E = 0 coefficients:
+     *       const simd<Type, N> &A, &B, &C, &D, &E;
+     *   - 4 roots lanes:
+     *       simd<Type, N> *S;
+     * RETURNS:
+     *   (simd<int, N>) number of real roots (0 to 4, double roots of
+     *                  one quadratic factor counted once).
+     */
+#ifdef __CUDA__
+    __host__ __device__
+#endif /* __CUDA__ */
+    template<typename Type, int N>
+      constexpr static simd<int, N> QuarticSolver( const simd<Type, N> &A, const simd<Type, N> &B, const simd<Type, N> &C, const simd<Type, N> &D, const simd<Type, N> &E,
+                                                   simd<Type, N> *S ) noexcept
+      {
+        using lanes = simd<Type, N>;
+        const lanes
+          Zero(0), One(1), Two(2),
+          Inf(std::numeric_limits<Type>::infinity()),
+          NaN(std::numeric_limits<Type>::quiet_NaN());
+        const auto IsCubic = A == Zero;
+
+        /* Degenerate lanes */
+        lanes Cb[3];
+        const simd<int, N> CbCount = CubicSolver(B, C, D, E, Cb);
+
+        /* Depressed quartic, x = y - Shift */
+        const lanes
+          RevA = One / Select(IsCubic, One, A),
+          a = B * RevA, b = C * RevA, c = D * RevA, d = E * RevA,
+          Shift = a * lanes(0.25),
+          Shift2 = Shift * Shift,
+          p = b - lanes(6) * Shift2,
+          q = c - Two * b * Shift + lanes(8) * Shift2 * Shift,
+          r = d - c * Shift + b * Shift2 - lanes(3) * Shift2 * Shift2;
+
+        /* Largest resolvent root z^3 + 2p z^2 + (p^2 - 4r) z - q^2 = 0 (non negative) */
+        lanes Rs[3];
+        CubicSolver(One, Two * p, p * p - lanes(4) * r, -q * q, Rs);
+        lanes Z = Rs[0];
+
+        Z = Select(Rs[1] == Rs[1], Rs[1], Z);
+        Z = Select(Rs[2] == Rs[2], Rs[2], Z);
+        Z = Max(Z, Zero);
+
+        /* Quadratic factors (y^2 + u y + s)(y^2 - u y + t) */
+        const auto IsBiquad = Z <= lanes(std::numeric_limits<Type>::epsilon()) * (Abs(p) + Sqrt(Abs(r)));
+        const lanes
+          U = Sqrt(Z),
+          QU = q / Select(IsBiquad, One, U),
+          Sf = (p + Z - QU) * lanes(0.5),
+          Tf = (p + Z + QU) * lanes(0.5);
+        lanes Y[4];
+        const simd<int, N>
+          Cnt0 = SquareSolver(One, U, Sf, Y),
+          Cnt1 = SquareSolver(One, -U, Tf, Y + 2);
+
+        /* Biquadratic y^4 + p y^2 + r = 0 */
+        lanes W[2];
+        SquareSolver(One, p, r, W);
+        const lanes
+          W0 = Select(W[0] >= Zero, Sqrt(Max(W[0], Zero)), NaN),
+          W1 = Select(W[1] >= Zero, Sqrt(Max(W[1], Zero)), NaN);
+
+        Y[0] = Select(IsBiquad, Select(W0 > Zero, -W0, NaN), Y[0]);
+        Y[1] = Select(IsBiquad, W0, Y[1]);
+        Y[2] = Select(IsBiquad, Select(W1 > Zero, -W1, NaN), Y[2]);
+        Y[3] = Select(IsBiquad, W1, Y[3]);
+
+        /* Polish, drop NaN slots to the end and sort */
+        for (int i = 0; i < 4; i++)
+        {
+          for (int k = 0; k < 2; k++)
+          {
+            const lanes
+              Y2 = Y[i] * Y[i],
+              F = (Y2 + p) * Y2 + q * Y[i] + r,
+              Df = (lanes(4) * Y2 + Two * p) * Y[i] + q,
+              Yn = Y[i] - F / Select(Df != Zero, Df, One),
+              Yn2 = Yn * Yn,
+              Fn = (Yn2 + p) * Yn2 + q * Yn + r;
+
+            Y[i] = Select((Df != Zero) & (Abs(Fn) < Abs(F)), Yn, Y[i]);
+          }
+          Y[i] = Select(Y[i] == Y[i], Y[i] - Shift, Inf);
+        }
+        constexpr int Net[5][2] = {{0, 1}, {2, 3}, {0, 2}, {1, 3}, {1, 2}};
+
+        for (const auto &P : Net)
+        {
+          const lanes Lo = Min(Y[P[0]], Y[P[1]]);
+
+          Y[P[1]] = Max(Y[P[0]], Y[P[1]]);
+          Y[P[0]] = Lo;
+        }
+
+        const lanes Count(Select(IsBiquad,
+          Select(W0 == W0, Select(W0 == Zero, One, Two), Zero) + Select(W1 == W1, Select(W1 == Zero, One, Two), Zero),
+          lanes(Cnt0) + lanes(Cnt1)));
+
+        for (int i = 0; i < 4; i++)
+          S[i] = Select(IsCubic, i < 3 ? Cb[i] : NaN, Select(Y[i] != Inf, Y[i], NaN));
+        return simd<int, N>(Select(IsCubic, lanes(CbCount), Count));
+      } /* End of 'QuarticSolver' function */
+
+    /* Square equations array solver.
+     * ARGUMENTS:
+     *   - equations coefficients arrays:
+     *       const Type *A, *B, *C;
+     *   - roots arrays (ascending, NaN past root count):
+     *       Type *S0, *S1;
+     *   - roots counts array:
+     *       int *Count;
+     *   - number of equations:
+     *       const int Num;
+     * RETURNS: None.
+     */
+    template<int N = 8, typename Type>
+      static void SquareSolver( const Type *A, const Type *B, const Type *C, Type *S0, Type *S1, int *Count, const int Num ) noexcept
+      {
+        const Type *In[] = {A, B, C};
+        Type *Out[] = {S0, S1};
+
+        SolveArrays<N, 3, 2>(In, Out, Count, Num,
+          []( const simd<Type, N> *K, simd<Type, N> *S )
+          {
+            return SquareSolver(K[0], K[1], K[2], S);
+          });
+      } /* End of 'SquareSolver' function */
+
+    /* Cubic equations array solver.
+     * ARGUMENTS:
+     *   - equations coefficients arrays:
+     *       const Type *A, *B, *C, *D;
+     *   - roots arrays (ascending, NaN past root count):
+     *       Type *S0, *S1, *S2;
+     *   - roots counts array:
+     *       int *Count;
+     *   - number of equations:
+     *       const int Num;
+     * RETURNS: None.
+     */
+    template<int N = 8, typename Type>
+      static void CubicSolver( const Type *A, const Type *B, const Type *C, const Type *D, Type *S0, Type *S1, Type *S2, int *Count, const int Num ) noexcept
+      {
+        const Type *In[] = {A, B, C, D};
+        Type *Out[] = {S0, S1, S2};
+
+        SolveArrays<N, 4, 3>(In, Out, Count, Num,
+          []( const simd<Type, N> *K, simd<Type, N> *S )
+          {
+            return CubicSolver(K[0], K[1], K[2], K[3], S);
+          });
+      } /* End of 'CubicSolver' function */
+
+    /* Quartic equations array solver.
+     * ARGUMENTS:
+     *   - equations coefficients arrays:
+     *       const Type *A, *B, *C, *D, *E;
+     *   - roots arrays (ascending, NaN past root count):
+     *       Type *S0, *S1, *S2, *S3;
+     *   - roots counts array:
+     *       int *Count;
+     *   - number of equations:
+     *       const int Num;
+     * RETURNS: None.
+     */
+    template<int N = 8, typename Type>
+      static void QuarticSolver( const Type *A, const Type *B, const Type *C, const Type *D, const Type *E,
+                                 Type *S0, Type *S1, Type *S2, Type *S3, int *Count, const int Num ) noexcept
+      {
+        const Type *In[] = {A, B, C, D, E};
+        Type *Out[] = {S0, S1, S2, S3};
+
+        SolveArrays<N, 5, 4>(In, Out, Count, Num,
+          []( const simd<Type, N> *K, simd<Type, N> *S )
+          {
+            return QuarticSolver(K[0], K[1], K[2], K[3], K[4], S);
+          });
+      } /* End of 'QuarticSolver' function */
+
+    /* Find root in sign change interval by Brent method function.
+     * Combines bisection, secant and inverse quadratic interpolation
+     * steps, so convergence is never slower than bisection.
+     * ARGUMENTS:
+     *   - function to find root of (called as F(X)):
+     *       const Func &F;
+     *   - interval (function signs at ends have to differ):
+     *       Type A, B;
+     *   - root:
+     *       Type &Root;
+     *   - absolute tolerance (0 for machine precision):
+     *       const Type Tol = 0;
+     *   - maximal number of iterations:
+     *       const int MaxIter = 100;
+     * RETURNS:
+     *   (bool) true if root is found.
+     */
+#ifdef __CUDA__
+    __host__ __device__
+#endif /* __CUDA__ */
+    template<typename Type, typename Func>
+      constexpr static bool Brent( const Func &F, Type A, Type B, Type &Root, const Type Tol = 0, const int MaxIter = 100 ) noexcept
+      {
+        constexpr Type Eps = std::numeric_limits<Type>::epsilon();
+        Type Fa = F(A), Fb = F(B);
+
+        if (Fa == 0 || Fb == 0)
+        {
+          Root = Fa == 0 ? A : B;
+          return true;
+        }
+        if ((Fa > 0) == (Fb > 0))
+          return false;
+
+        Type C = B, Fc = Fb, D = B - A, E = D;
+
+        for (int i = 0; i < MaxIter; i++)
+        {
+          /* Keep root between B and C, B being the best estimate */
+          if ((Fb > 0) == (Fc > 0))
+          {
+            C = A, Fc = Fa;
+            E = D = B - A;
+          }
+          if (Abs(Fc) < Abs(Fb))
+          {
+            A = B, Fa = Fb;
+            B = C, Fb = Fc;
+            C = A, Fc = Fa;
+          }
+
+          const Type
+            Tol1 = 2 * Eps * Abs(B) + Tol / 2,
+            Xm = (C - B) / 2;
+
+          if (Abs(Xm) <= Tol1 || Fb == 0)
+          {
+            Root = B;
+            return true;
+          }
+
+          if (Abs(E) >= Tol1 && Abs(Fa) > Abs(Fb))
+          {
+            /* Secant (A == C) or inverse quadratic interpolation */
+            const Type S = Fb / Fa;
+            Type P, Q;
+
+            if (A == C)
+            {
+              P = 2 * Xm * S;
+              Q = 1 - S;
+            }
+            else
+            {
+              const Type
+                Qa = Fa / Fc,
+                R = Fb / Fc;
+
+              P = S * (2 * Xm * Qa * (Qa - R) - (B - A) * (R - 1));
+              Q = (Qa - 1) * (R - 1) * (S - 1);
+            }
+            if (P > 0)
+              Q = -Q;
+            P = Abs(P);
+
+            if (2 * P < Min(3 * Xm * Q - Abs(Tol1 * Q), Abs(E * Q)))
+            {
+              E = D;
+              D = P / Q;
+            }
+            else
+              E = D = Xm;
+          }
+          else
+            E = D = Xm;
+
+          A = B, Fa = Fb;
+          B += Abs(D) > Tol1 ? D : Xm > 0 ? Tol1 : -Tol1;
+          Fb = F(B);
+        }
+        Root = B;
+        return false;
+      } /* End of 'Brent' function */
+
+    /* Find roots in sign change intervals array by Brent method function.
+     * ARGUMENTS:
+     *   - function to find root of (called as F(Index, X)):
+     *       const Func &F;
+     *   - intervals ends arrays:
+     *       const Type *A, *B;
+     *   - roots array (NaN for not found roots):
+     *       Type *Roots;
+     *   - number of equations:
+     *       const int Num;
+     *   - absolute tolerance (0 for machine precision):
+     *       const Type Tol = 0;
+     * RETURNS:
+     *   (int) number of found roots.
+     */
+    template<typename Type, typename Func>
+      static int Brent( const Func &F, const Type *A, const Type *B, Type *Roots, const int Num, const Type Tol = 0 )
+      {
+        std::atomic<int> Count = 0;
+
+        parallel::For(0, Num,
+          [&]( const int Begin, const int End, const int )
+          {
+            int Found = 0;
+
+            for (int i = Begin; i < End; i++)
+              if (Brent([&]( const Type X ){ return F(i, X); }, A[i], B[i], Roots[i], Tol))
+                Found++;
+              else
+                Roots[i] = std::numeric_limits<Type>::quiet_NaN();
+            Count += Found;
+          }, 64);
+        return Count;
+      } /* End of 'Brent' function */
+
+    /* Find root in sign change interval by safeguarded Newton method function.
+     * Newton steps leaving bracket or converging slower than bisection
+     * are replaced by bisection. Derivative is taken from function if it
+     * is callable as F(X, DF) (returns value, sets derivative), otherwise
+     * function is evaluated once over 'dual' number per step.
+     * ARGUMENTS:
+     *   - function to find root of:
+     *       const Func &F;
+     *   - interval (function signs at ends have to differ):
+     *       Type A, B;
+     *   - root:
+     *       Type &Root;
+     *   - absolute tolerance (0 for machine precision):
+     *       const Type Tol = 0;
+     *   - maximal number of iterations:
+     *       const int MaxIter = 100;
+     * RETURNS:
+     *   (bool) true if root is found.
+     */
+#ifdef __CUDA__
+    __host__ __device__
+#endif /* __CUDA__ */
+    template<typename Type, typename Func>
+      constexpr static bool Newton( const Func &F, Type A, Type B, Type &Root, const Type Tol = 0, const int MaxIter = 100 ) noexcept
+      {
+        constexpr Type Eps = std::numeric_limits<Type>::epsilon();
+        const auto Eval =
+          [&]( const Type X, Type &DF ) -> Type
+          {
+            if constexpr (std::is_invocable_v<const Func &, Type, Type &>)
+              return F(X, DF);
+            else
+            {
+              const dual<Type> R = F(dual<Type>::Variable(X, 0));
+
+              DF = R.D[0];
+              return R.V;
+            }
+          };
+        Type DF = 0;
+        const Type
+          Fa = Eval(A, DF),
+          Fb = Eval(B, DF);
+
+        if (Fa == 0 || Fb == 0)
+        {
+          Root = Fa == 0 ? A : B;
+          return true;
+        }
+        if ((Fa > 0) == (Fb > 0))
+          return false;
+
+        /* Orient bracket so that F(Lo) < 0 */
+        Type
+          Lo = Fa < 0 ? A : B,
+          Hi = Fa < 0 ? B : A,
+          X = (A + B) / 2,
+          Step = Abs(B - A),
+          PrevStep = Step,
+          Fx = Eval(X, DF);
+
+        for (int i = 0; i < MaxIter; i++)
+        {
+          if (Fx == 0)
+          {
+            Root = X;
+            return true;
+          }
+          if (((X - Hi) * DF - Fx) * ((X - Lo) * DF - Fx) > 0 || Abs(2 * Fx) > Abs(PrevStep * DF))
+          {
+            PrevStep = Step;
+            Step = (Hi - Lo) / 2;
+            X = Lo + Step;
+          }
+          else
+          {
+            PrevStep = Step;
+            Step = Fx / DF;
+            X -= Step;
+          }
+          if (Abs(Step) <= Tol + 2 * Eps * Abs(X))
+          {
+            Root = X;
+            return true;
+          }
+          Fx = Eval(X, DF);
+          if (Fx < 0)
+            Lo = X;
+          else
+            Hi = X;
+        }
+        Root = X;
+        return false;
+      } /* End of 'Newton' function */
+
+    /* Nonlinear least squares by Gauss-Newton method function.
+     * Minimizes half sum of squared residuals. Residuals function is
+     * called as R(X, Res) with both 'Type' and 'dual<Type, P>' arrays
+     * (generic lambda), Jacobian is taken from dual evaluation, so no
+     * finite differences are needed. All workspaces are fixed size.
+     * ARGUMENTS:
+     *   - residuals function:
+     *       const Func &R;
+     *   - parameters (initial guess, result):
+     *       Type *X;
+     *   - final cost (may be nullptr):
+     *       Type *Cost = nullptr;
+     *   - maximal number of iterations:
+     *       const int MaxIter = 50;
+     *   - relative step tolerance:
+     *       const Type Tol = sqrt(epsilon);
+     * RETURNS:
+     *   (bool) true if converged.
+     */
+    template<int P, int M, typename Type, typename Func>
+      constexpr static bool GaussNewton( const Func &R, Type *X, Type *Cost = nullptr, const int MaxIter = 50,
+                                         const Type Tol = std::sqrt(std::numeric_limits<Type>::epsilon()) ) noexcept
+      {
+        return LeastSquares<P, M>(R, X, Type(0), Cost, MaxIter, Tol);
+      } /* End of 'GaussNewton' function */
+
+    /* Nonlinear least squares by Levenberg-Marquardt method function.
+     * Same as 'GaussNewton', but normal equations diagonal is damped
+     * and steps increasing cost are rejected.
+     * ARGUMENTS:
+     *   - residuals function (called as R(X, Res) for 'Type' and 'dual<Type, P>'):
+     *       const Func &R;
+     *   - parameters (initial guess, result):
+     *       Type *X;
+     *   - final cost (may be nullptr):
+     *       Type *Cost = nullptr;
+     *   - maximal number of iterations:
+     *       const int MaxIter = 50;
+     *   - relative step tolerance:
+     *       const Type Tol = sqrt(epsilon);
+     * RETURNS:
+     *   (bool) true if converged.
+     */
+    template<int P, int M, typename Type, typename Func>
+      constexpr static bool LevenbergMarquardt( const Func &R, Type *X, Type *Cost = nullptr, const int MaxIter = 50,
+                                                const Type Tol = std::sqrt(std::numeric_limits<Type>::epsilon()) ) noexcept
+      {
+        return LeastSquares<P, M>(R, X, Type(1e-3), Cost, MaxIter, Tol);
+      } /* End of 'LevenbergMarquardt' function */
+
+    /* Independent nonlinear least squares problems array by Levenberg-Marquardt method function.
+     * ARGUMENTS:
+     *   - residuals function (called as R(Index, X, Res)):
+     *       const Func &R;
+     *   - parameters array (P values per problem):
+     *       Type *X;
+     *   - number of problems:
+     *       const int Num;
+     *   - final costs array (may be nullptr):
+     *       Type *Cost = nullptr;
+     *   - maximal number of iterations:
+     *       const int MaxIter = 50;
+     * RETURNS:
+     *   (int) number of converged problems.
+     */
+    template<int P, int M, typename Type, typename Func>
+      static int LevenbergMarquardt( const Func &R, Type *X, const int Num, Type *Cost = nullptr, const int MaxIter = 50 )
+      {
+        std::atomic<int> Count = 0;
+
+        parallel::For(0, Num,
+          [&]( const int Begin, const int End, const int )
+          {
+            int Converged = 0;
+
+            for (int i = Begin; i < End; i++)
+              if (LevenbergMarquardt<P, M>(
+                    [&]( const auto *Xi, auto *Ri )
+                    {
+                      R(i, Xi, Ri);
+                    }, X + static_cast<size_t>(i) * P, Cost != nullptr ? Cost + i : nullptr, MaxIter))
+                Converged++;
+            Count += Converged;
+          }, 16);
+        return Count;
+      } /* End of 'LevenbergMarquardt' function */
+
+    /* Refine rigid transform by projected points function.
+     * Finds rotation Q and translation T, so points transformed by
+     * 'Q.RotateMatr() * matr::Translate(T)' and projected by view
+     * projection matrix (e.g. 'camera::MatrVP') match observed
+     * normalized device coordinates. Rotation is updated by rotation
+     * vector (see 'quat::Exp'), so 6 parameters are optimized.
+     * ARGUMENTS:
+     *   - rotation (initial guess, result):
+     *       quat<Type> &Q;
+     *   - translation (initial guess, result):
+     *       vec3<Type> &T;
+     *   - points:
+     *       const vec3<Type> *Points;
+     *   - observed points projections (normalized device coordinates):
+     *       const vec2<Type> *Projections;
+     *   - view projection matrix:
+     *       const matr<Type> &VP;
+     *   - final cost (may be nullptr):
+     *       Type *Cost = nullptr;
+     *   - maximal number of iterations:
+     *       const int MaxIter = 50;
+     * RETURNS:
+     *   (bool) true if converged.
+     */
+    template<int M, typename Type>
+      static bool PoseRefine( quat<Type> &Q, vec3<Type> &T, const vec3<Type> *Points, const vec2<Type> *Projections,
+                              const matr<Type> &VP, Type *Cost = nullptr, const int MaxIter = 50 ) noexcept
+      {
+        Type X[6] = {0, 0, 0, T.X, T.Y, T.Z};
+        const bool IsConverged = LevenbergMarquardt<6, 2 * M>(
+          [&]( const auto *X, auto *R )
+          {
+            using var = std::remove_cvref_t<decltype(X[0])>;
+
+            const quat<var> Qv = quat<var>::Exp(vec3<var>(X[0], X[1], X[2])) * quat<var>(Q.W, vec3<var>(Q.X, Q.Y, Q.Z));
+            const matr<var> Mv = Qv.RotateMatr() * matr<var>::Translate(vec3<var>(X[3], X[4], X[5])) * matr<var>(VP);
+
+            for (int i = 0; i < M; i++)
+            {
+              const vec3<var> P = Mv.Transform4x4(vec3<var>(Points[i].X, Points[i].Y, Points[i].Z));
+
+              R[2 * i] = P.X - Projections[i].X;
+              R[2 * i + 1] = P.Y - Projections[i].Y;
+            }
+          }, X, Cost, MaxIter);
+
+        Q = (quat<Type>::Exp(vec3<Type>(X[0], X[1], X[2])) * Q).Normalized();
+        T = vec3<Type>(X[3], X[4], X[5]);
+        return IsConverged;
+      } /* End of 'PoseRefine' function */
+
+  private:
+    /* Run lanes solver over structure of arrays function.
+     * Tail equations are solved in zero padded lanes.
+     * ARGUMENTS:
+     *   - coefficients arrays:
+     *       const Type *const *In;
+     *   - roots arrays:
+     *       Type *const *Out;
+     *   - roots counts array:
+     *       int *Count;
+     *   - number of equations:
+     *       const int Num;
+     *   - lanes solver (returns roots count):
+     *       const Func &F;
+     * RETURNS: None.
+     */
+    template<int N, int InNum, int OutNum, typename Type, typename Func>
+      static void SolveArrays( const Type *const *In, Type *const *Out, int *Count, const int Num, const Func &F ) noexcept
+      {
+        for (int i = 0; i < Num; i += N)
+        {
+          const int Size = Num - i < N ? Num - i : N;
+          simd<Type, N> K[InNum], S[OutNum];
+
+          for (int j = 0; j < InNum; j++)
+            if (Size == N)
+              K[j] = simd<Type, N>::Load(In[j] + i);
+            else
+            {
+              K[j] = simd<Type, N>(0);
+              for (int l = 0; l < Size; l++)
+                K[j].V[l] = In[j][i + l];
+            }
+
+          const simd<int, N> Cnt = F(K, S);
+
+          if (Size == N)
+          {
+            for (int j = 0; j < OutNum; j++)
+              S[j].Store(Out[j] + i);
+            Cnt.Store(Count + i);
+          }
+          else
+            for (int l = 0; l < Size; l++)
+            {
+              for (int j = 0; j < OutNum; j++)
+                Out[j][i + l] = S[j].V[l];
+              Count[i + l] = Cnt.V[l];
+            }
+        }
+      } /* End of 'SolveArrays' function */
+
+    /* Nonlinear least squares solver function.
+     * Normal equations are accumulated from dual residuals directly
+     * (Jacobian is not stored) and solved by Cholesky factorization.
+     * ARGUMENTS:
+     *   - residuals function (called as R(X, Res)):
+     *       const Func &R;
+     *   - parameters (initial guess, result):
+     *       Type *X;
+     *   - initial damping (0 for Gauss-Newton steps):
+     *       Type Lambda;
+     *   - final cost (may be nullptr):
+     *       Type *Cost;
+     *   - maximal number of iterations:
+     *       const int MaxIter;
+     *   - relative step tolerance:
+     *       const Type Tol;
+     * RETURNS:
+     *   (bool) true if converged (false for not finite residuals).
+     */
+    template<int P, int M, typename Type, typename Func>
+      constexpr static bool LeastSquares( const Func &R, Type *X, Type Lambda, Type *Cost, const int MaxIter, const Type Tol ) noexcept
+      {
+        static_assert(P > 0 && M >= P, "At least as many residuals as parameters are needed in least squares");
+
+        using var = dual<Type, P>;
+
+        constexpr Type
+          Eps = std::numeric_limits<Type>::epsilon(),
+          MaxLambda = 1 / Eps,
+          MaxCost = std::numeric_limits<Type>::max();
+        const bool IsDamped = Lambda > 0;
+        var Xd[P], Rd[M];
+        Type Xn[P], Rn[M], G[P], Step[P], C = 0;
+        bool IsConverged = false;
+
+        for (int Iter = 0; Iter < MaxIter && !IsConverged; Iter++)
+        {
+          /* Linearize at X */
+          for (int i = 0; i < P; i++)
+            Xd[i] = var::Variable(X[i], i);
+          R(static_cast<const var *>(Xd), Rd);
+
+          matn<P, Type> H;
+
+          C = 0;
+          for (int i = 0; i < P; i++)
+            G[i] = 0;
+          for (int k = 0; k < M; k++)
+          {
+            C += Rd[k].V * Rd[k].V;
+            for (int i = 0; i < P; i++)
+            {
+              G[i] += Rd[k].D[i] * Rd[k].V;
+              for (int j = 0; j <= i; j++)
+                H[i][j] += Rd[k].D[i] * Rd[k].D[j];
+            }
+          }
+          C /= 2;
+          for (int i = 0; i < P; i++)
+            for (int j = 0; j < i; j++)
+              H[j][i] = H[i][j];
+          if (C == 0)
+          {
+            IsConverged = true;
+            break;
+          }
+          /* Not finite residuals (NaN fails comparison too) */
+          if (!(C <= MaxCost))
+            break;
+
+          /* Solve (H + Lambda * diag(H)) * Step = G until cost decreases */
+          for (;;)
+          {
+            matn<P, Type> A = H;
+
+            for (int i = 0; i < P; i++)
+              A[i][i] += Lambda * Max(H[i][i], Eps);
+
+            const auto F = A.Cholesky();
+            Type Cn = 0;
+
+            if (F.Ok)
+            {
+              F.Solve(G, Step);
+              for (int i = 0; i < P; i++)
+                Xn[i] = X[i] - Step[i];
+              R(static_cast<const Type *>(Xn), Rn);
+              for (int k = 0; k < M; k++)
+                Cn += Rn[k] * Rn[k];
+              Cn /= 2;
+            }
+
+            if (F.Ok && Cn <= MaxCost && (!IsDamped || Cn <= C))
+            {
+              Type S2 = 0, X2 = 0;
+
+              for (int i = 0; i < P; i++)
+              {
+                S2 += Step[i] * Step[i];
+                X2 += Xn[i] * Xn[i];
+                X[i] = Xn[i];
+              }
+              C = Cn;
+              IsConverged = S2 <= Tol * Tol * (X2 + Tol * Tol);
+              if (IsDamped)
+                Lambda = Max(Lambda / 10, Eps);
+              break;
+            }
+            if (!IsDamped)
+            {
+              if (Cost != nullptr)
+                *Cost = C;
+              return false;
+            }
+
+            /* No decrease along any damped step - minimum is reached (if nearby cost is finite) */
+            if ((Lambda *= 10) > MaxLambda)
+            {
+              if (!(Cn <= MaxCost))
+              {
+                if (Cost != nullptr)
+                  *Cost = C;
+                return false;
+              }
+              IsConverged = true;
+              break;
+            }
+          }
+        }
+        if (Cost != nullptr)
+          *Cost = C;
+        return IsConverged;
+      } /* End of 'LeastSquares' function */
+
   }; /* End of 'solver' class */
 } /* end of 'mth' namespace */
 
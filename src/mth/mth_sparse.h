@@ -0,0 +1,473 @@
+/***************************************************************
+ * FILE NAME   : mth_sparse.h
+ * PURPOSE     : Sparse matrix and iterative solvers module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_sparse_h_
+#define __mth_sparse_h_
+
+#include <algorithm>
+#include <barrier>
+#include <cmath>
+#include <vector>
+
+#include "mth_def.h"
+#include "mth_parallel.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+
+  /* Sparse matrix (compressed sparse rows) class.
+   * Rows products and vector reductions are split between threads,
+   * symmetric positive definite systems are solved by preconditioned
+   * conjugate gradients, 3D grid systems (7 point stencils, rows indexed
+   * by 'vec3::Index3D') by red-black Gauss-Seidel sweeps.
+   */
+  template<typename Type = DBL>
+    class sparse
+    {
+      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in sparse");
+
+    public:
+      static const int PARALLEL_MIN = 4096; // Minimal rows count per thread
+
+      /* Conjugate gradients preconditioners */
+      enum struct precond
+      {
+        NONE,   // No preconditioning
+        JACOBI, // Diagonal scaling
+        IC0     // Incomplete Cholesky with matrix pattern (Jacobi on breakdown)
+      }; /* End of 'precond' enumeration */
+
+      /* Matrix element type */
+      struct triplet
+      {
+        int Row, Col; // Element position
+        Type Val;     // Element value
+      }; /* End of 'triplet' structure */
+
+      int Rows = 0, Cols = 0;    // Matrix size
+      std::vector<int> RowStart; // Rows elements start indices (Rows + 1 values)
+      std::vector<int> Col;      // Elements columns (ascending in row)
+      std::vector<Type> Val;     // Elements values
+
+      /* Class default constructor */
+      sparse( void ) = default;
+
+      /* Class constructor.
+       * ARGUMENTS:
+       *   - matrix size:
+       *       const int NewRows, NewCols;
+       *   - matrix elements (duplicates are summed):
+       *       std::vector<triplet> Elements;
+       */
+      sparse( const int NewRows, const int NewCols, std::vector<triplet> Elements ) : Rows(NewRows), Cols(NewCols), RowStart(NewRows + 1, 0)
+      {
+        std::sort(Elements.begin(), Elements.end(),
+          []( const triplet &A, const triplet &B )
+          {
+            return A.Row < B.Row || (A.Row == B.Row && A.Col < B.Col);
+          });
+        for (size_t i = 0; i < Elements.size(); i++)
+          if (!Col.empty() && i > 0 && Elements[i].Row == Elements[i - 1].Row && Elements[i].Col == Elements[i - 1].Col)
+            Val.back() += Elements[i].Val;
+          else
+          {
+            Col.push_back(Elements[i].Col);
+            Val.push_back(Elements[i].Val);
+            RowStart[Elements[i].Row + 1]++;
+          }
+        for (int i = 0; i < Rows; i++)
+          RowStart[i + 1] += RowStart[i];
+      } /* End of 'sparse' function */
+
+      /* Build 3D grid Poisson matrix (7 point Laplacian, zero boundary) function.
+       * ARGUMENTS:
+       *   - grid size (rows indexed by 'vec3::Index3D'):
+       *       const vec3<int> &Size;
+       * RETURNS:
+       *   (sparse) matrix.
+       */
+      static sparse Poisson3D( const vec3<int> &Size )
+      {
+        const int Count = Size.X * Size.Y * Size.Z;
+        std::vector<triplet> E;
+
+        E.reserve(static_cast<size_t>(Count) * 7);
+        for (int y = 0; y < Size.Y; y++)
+          for (int z = 0; z < Size.Z; z++)
+            for (int x = 0; x < Size.X; x++)
+            {
+              const int I = vec3<int>(x, y, z).Index3D(Size);
+              const int Nb[6][3] = {{x - 1, y, z}, {x + 1, y, z}, {x, y - 1, z}, {x, y + 1, z}, {x, y, z - 1}, {x, y, z + 1}};
+
+              E.push_back({I, I, 6});
+              for (const auto &P : Nb)
+                if (P[0] >= 0 && P[0] < Size.X && P[1] >= 0 && P[1] < Size.Y && P[2] >= 0 && P[2] < Size.Z)
+                  E.push_back({I, vec3<int>(P[0], P[1], P[2]).Index3D(Size), -1});
+            }
+        return sparse(Count, Count, std::move(E));
+      } /* End of 'Poisson3D' function */
+
+      /* Matrix by vector multiplication function.
+       * ARGUMENTS:
+       *   - vector (Cols values):
+       *       const Type *X;
+       *   - result vector (Rows values):
+       *       Type *Y;
+       * RETURNS: None.
+       */
+      void Apply( const Type *X, Type *Y ) const
+      {
+        parallel::For(0, Rows,
+          [&]( const int Begin, const int End, const int )
+          {
+            for (int i = Begin; i < End; i++)
+            {
+              Type S = 0;
+
+              for (int k = RowStart[i]; k < RowStart[i + 1]; k++)
+                S += Val[k] * X[Col[k]];
+              Y[i] = S;
+            }
+          }, PARALLEL_MIN);
+      } /* End of 'Apply' function */
+
+      /* Solve symmetric positive definite system by preconditioned conjugate gradients function.
+       * Whole solve is one parallel region: workers own contiguous rows
+       * ranges and meet on barrier for reductions only (matrix product is
+       * fused with its dot product, vectors update with residual norm).
+       * ARGUMENTS:
+       *   - right hand side:
+       *       const Type *B;
+       *   - solution (in: initial guess, out: solution):
+       *       Type *X;
+       *   - preconditioner:
+       *       const precond P = precond::JACOBI;
+       *   - relative residual tolerance:
+       *       const Type Tol = 1e-8;
+       *   - maximal iterations:
+       *       const int MaxIter = 1000;
+       *   - achieved relative residual (may be nullptr):
+       *       Type *Residual = nullptr;
+       *   - maximal number of threads (0 for all hardware threads):
+       *       const int MaxThreads = 0;
+       * RETURNS:
+       *   (int) number of iterations.
+       */
+      int CG( const Type *B, Type *X, const precond P = precond::JACOBI, const Type Tol = static_cast<Type>(1e-8), const int MaxIter = 1000,
+              Type *Residual = nullptr, const int MaxThreads = 0 ) const
+      {
+        const int n = Rows;
+        std::vector<Type> R(n), Z(n), Pv(n), Ap(n), InvDiag;
+        sparse L;
+        precond Kind = P;
+
+        /* Preconditioner setup */
+        if (Kind == precond::IC0 && !IncompleteCholesky(L))
+          Kind = precond::JACOBI;
+        if (Kind == precond::JACOBI)
+        {
+          InvDiag.resize(n);
+          for (int i = 0; i < n; i++)
+          {
+            const Type D = Diagonal(i);
+
+            InvDiag[i] = D != 0 ? 1 / D : 1;
+          }
+        }
+
+        /* Reductions partial sums (slot per reduced value, value per worker) */
+        enum { BB, RR, RZ, PAP, SLOTS };
+        const int
+          Threads = MaxThreads > 0 && MaxThreads < parallel::ThreadsCount() ? MaxThreads : parallel::ThreadsCount(),
+          Workers = std::clamp(n / PARALLEL_MIN, 1, Threads);
+        std::vector<Type> Part(SLOTS * Workers);
+        std::barrier Sync(Workers);
+        Type NormB = 0, Res = 0;
+        int Iter = 0;
+
+        parallel::For(0, Workers,
+          [&]( const int, const int, const int W )
+          {
+            const int
+              Begin = static_cast<int>(static_cast<long long>(n) * W / Workers),
+              End = static_cast<int>(static_cast<long long>(n) * (W + 1) / Workers);
+            /* Sum workers partial values (same order in all workers, so all take same branches) */
+            const auto Sum =
+              [&]( const int Slot )
+              {
+                Type S = 0;
+
+                for (int i = 0; i < Workers; i++)
+                  S += Part[Slot * Workers + i];
+                return S;
+              };
+            /* Apply preconditioner to rows range, Z = M^-1 * R (R is complete), returns R * Z */
+            const auto Precondition =
+              [&]( void )
+              {
+                Type S = 0;
+
+                if (Kind == precond::IC0)
+                {
+                  if (W == 0)
+                    L.CholeskySolve(R.data(), Z.data());
+                  Sync.arrive_and_wait();
+                }
+                for (int i = Begin; i < End; i++)
+                {
+                  if (Kind == precond::JACOBI)
+                    Z[i] = R[i] * InvDiag[i];
+                  else if (Kind == precond::NONE)
+                    Z[i] = R[i];
+                  S += R[i] * Z[i];
+                }
+                Part[RZ * Workers + W] = S;
+                Sync.arrive_and_wait();
+                return Sum(RZ);
+              };
+
+            /* Initial residual */
+            Type Sbb = 0, Srr = 0;
+
+            for (int i = Begin; i < End; i++)
+            {
+              Type S = 0;
+
+              for (int k = RowStart[i]; k < RowStart[i + 1]; k++)
+                S += Val[k] * X[Col[k]];
+              R[i] = B[i] - S;
+              Sbb += B[i] * B[i];
+              Srr += R[i] * R[i];
+            }
+            Part[BB * Workers + W] = Sbb;
+            Part[RR * Workers + W] = Srr;
+            Sync.arrive_and_wait();
+
+            const Type
+              Nb = std::sqrt(Sum(BB)),
+              Stop = Tol * (Nb > 0 ? Nb : 1);
+            Type Rs = std::sqrt(Sum(RR));
+            int It = 0;
+
+            if (Rs > Stop)
+            {
+              Type Rz = Precondition();
+
+              for (int i = Begin; i < End; i++)
+                Pv[i] = Z[i];
+              Sync.arrive_and_wait();
+
+              while (It < MaxIter)
+              {
+                It++;
+
+                /* Ap = A * P and P * Ap */
+                Type Spap = 0;
+
+                for (int i = Begin; i < End; i++)
+                {
+                  Type S = 0;
+
+                  for (int k = RowStart[i]; k < RowStart[i + 1]; k++)
+                    S += Val[k] * Pv[Col[k]];
+                  Ap[i] = S;
+                  Spap += Pv[i] * S;
+                }
+                Part[PAP * Workers + W] = Spap;
+                Sync.arrive_and_wait();
+
+                const Type PAp = Sum(PAP);
+
+                if (PAp <= 0)
+                  break;
+
+                const Type Alpha = Rz / PAp;
+
+                Srr = 0;
+                for (int i = Begin; i < End; i++)
+                {
+                  X[i] += Alpha * Pv[i];
+                  R[i] -= Alpha * Ap[i];
+                  Srr += R[i] * R[i];
+                }
+                Part[RR * Workers + W] = Srr;
+                Sync.arrive_and_wait();
+                Rs = std::sqrt(Sum(RR));
+                if (Rs <= Stop)
+                  break;
+
+                const Type
+                  RzNew = Precondition(),
+                  Beta = RzNew / Rz;
+
+                Rz = RzNew;
+                for (int i = Begin; i < End; i++)
+                  Pv[i] = Z[i] + Beta * Pv[i];
+                Sync.arrive_and_wait();
+              }
+            }
+            if (W == 0)
+              NormB = Nb, Res = Rs, Iter = It;
+          }, 1, Workers);
+        if (Residual != nullptr)
+          *Residual = Res / (NormB > 0 ? NormB : 1);
+        return Iter;
+      } /* End of 'CG' function */
+
+      /* Red-black Gauss-Seidel sweeps on 3D grid system function.
+       * Matrix rows are grid cells indexed by 'vec3::Index3D', couplings are
+       * allowed between face neighbours only, so all cells of one color
+       * ((X + Y + Z) parity) are independent and updated in parallel.
+       * ARGUMENTS:
+       *   - grid size:
+       *       const vec3<int> &Size;
+       *   - right hand side:
+       *       const Type *B;
+       *   - solution (in: initial guess, out: updated solution):
+       *       Type *X;
+       *   - number of sweeps (each sweep updates red then black cells):
+       *       const int Sweeps;
+       * RETURNS: None.
+       */
+      void GaussSeidelRB( const vec3<int> &Size, const Type *B, Type *X, const int Sweeps ) const
+      {
+        for (int s = 0; s < Sweeps; s++)
+          for (int Color = 0; Color < 2; Color++)
+            parallel::For(0, Size.Y,
+              [&]( const int Begin, const int End, const int )
+              {
+                for (int y = Begin; y < End; y++)
+                  for (int z = 0; z < Size.Z; z++)
+                    for (int x = (y + z + Color) & 1; x < Size.X; x += 2)
+                    {
+                      const int I = vec3<int>(x, y, z).Index3D(Size);
+                      Type S = B[I], D = 0;
+
+                      for (int k = RowStart[I]; k < RowStart[I + 1]; k++)
+                        if (Col[k] == I)
+                          D = Val[k];
+                        else
+                          S -= Val[k] * X[Col[k]];
+                      if (D != 0)
+                        X[I] = S / D;
+                    }
+              }, PARALLEL_MIN / (Size.X * Size.Z) + 1);
+      } /* End of 'GaussSeidelRB' function */
+
+      /* Get diagonal element function.
+       * ARGUMENTS:
+       *   - row index:
+       *       const int Row;
+       * RETURNS:
+       *   (Type) diagonal element (0 if not stored).
+       */
+      Type Diagonal( const int Row ) const noexcept
+      {
+        const auto Begin = Col.begin() + RowStart[Row], End = Col.begin() + RowStart[Row + 1];
+        const auto It = std::lower_bound(Begin, End, Row);
+
+        return It != End && *It == Row ? Val[It - Col.begin()] : 0;
+      } /* End of 'Diagonal' function */
+
+      /* Build incomplete Cholesky factor (matrix lower triangle pattern) function.
+       * ARGUMENTS:
+       *   - lower triangle factor (diagonal is last in every row):
+       *       sparse &L;
+       * RETURNS:
+       *   (bool) false on breakdown (non positive pivot).
+       */
+      bool IncompleteCholesky( sparse &L ) const
+      {
+        L.Rows = L.Cols = Rows;
+        L.RowStart.assign(Rows + 1, 0);
+        L.Col.clear();
+        L.Val.clear();
+        for (int i = 0; i < Rows; i++)
+        {
+          for (int k = RowStart[i]; k < RowStart[i + 1] && Col[k] <= i; k++)
+          {
+            L.Col.push_back(Col[k]);
+            L.Val.push_back(Val[k]);
+          }
+          if (L.Col.empty() || L.Col.back() != i)
+            return false;
+          L.RowStart[i + 1] = static_cast<int>(L.Col.size());
+        }
+
+        /* Row oriented factorization: row K of L is final before row I > K */
+        for (int i = 0; i < Rows; i++)
+        {
+          const int Begin = L.RowStart[i], Diag = L.RowStart[i + 1] - 1;
+
+          for (int p = Begin; p <= Diag; p++)
+          {
+            const int j = L.Col[p];
+            Type S = L.Val[p];
+
+            /* Merge rows I and J below column J */
+            for (int a = Begin, b = L.RowStart[j]; a < p && b < L.RowStart[j + 1] - 1; )
+              if (L.Col[a] < L.Col[b])
+                a++;
+              else if (L.Col[a] > L.Col[b])
+                b++;
+              else
+                S -= L.Val[a++] * L.Val[b++];
+
+            if (p < Diag)
+              L.Val[p] = S / L.Val[L.RowStart[j + 1] - 1];
+            else
+            {
+              if (S <= 0)
+                return false;
+              L.Val[p] = std::sqrt(S);
+            }
+          }
+        }
+        return true;
+      } /* End of 'IncompleteCholesky' function */
+
+      /* Solve L * L^T * X = B with lower triangle factor function.
+       * ARGUMENTS:
+       *   - right hand side:
+       *       const Type *B;
+       *   - solution:
+       *       Type *X;
+       * RETURNS: None.
+       */
+      void CholeskySolve( const Type *B, Type *X ) const
+      {
+        /* L * Y = B */
+        for (int i = 0; i < Rows; i++)
+        {
+          const int Diag = RowStart[i + 1] - 1;
+          Type S = B[i];
+
+          for (int k = RowStart[i]; k < Diag; k++)
+            S -= Val[k] * X[Col[k]];
+          X[i] = S / Val[Diag];
+        }
+
+        /* L^T * X = Y (columns of L^T are rows of L) */
+        for (int i = Rows - 1; i >= 0; i--)
+        {
+          const int Diag = RowStart[i + 1] - 1;
+
+          X[i] /= Val[Diag];
+          for (int k = RowStart[i]; k < Diag; k++)
+            X[Col[k]] -= Val[k] * X[i];
+        }
+      } /* End of 'CholeskySolve' function */
+
+    }; /* End of 'sparse' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_sparse_h_ */
+
+/* END OF 'mth_sparse.h' FILE */
@@ -0,0 +1,326 @@
+/***************************************************************
+ * FILE NAME   : mth_sym_tensor.h
+ * PURPOSE     : Symmetric tensor class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_sym_tensor_h_
+#define __mth_sym_tensor_h_
+
+#include "mth_def.h"
+#include "mth_tensor.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class quat;
+
+  /* Symmetric matrix 3x3 representation type.
+   * Only 6 upper triangle values are stored (covariance, inertia tensors),
+   * products use symmetry to skip repeated multiplications.
+   */
+  template<typename Type>
+    class sym_tensor
+    {
+      static_assert(number<Type>, "Number type is needed in sym_tensor");
+
+    public:
+      Type
+        XX = 0, YY = 0, ZZ = 0, // Diagonal elements
+        XY = 0, XZ = 0, YZ = 0; // Off diagonal elements
+
+      /* Class default constructor */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor( void ) = default;
+
+      /* Symmetric tensor constructor by 6 numbers.
+       * ARGUMENTS:
+       *   - diagonal elements:
+       *       const Type A00, A11, A22;
+       *   - off diagonal elements:
+       *       const Type A01, A02, A12;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor( const Type A00, const Type A11, const Type A22, const Type A01, const Type A02, const Type A12 ) noexcept :
+        XX(A00), YY(A11), ZZ(A22), XY(A01), XZ(A02), YZ(A12)
+      {
+      } /* End of 'sym_tensor' function */
+
+      /* Symmetric tensor constructor by symmetric part of tensor.
+       * ARGUMENTS:
+       *   - source tensor:
+       *       const tensor<Type> &T;
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      explicit constexpr sym_tensor( const tensor<Type> &T ) noexcept :
+        XX(T[0][0]), YY(T[1][1]), ZZ(T[2][2]),
+        XY((T[0][1] + T[1][0]) / 2), XZ((T[0][2] + T[2][0]) / 2), YZ((T[1][2] + T[2][1]) / 2)
+      {
+      } /* End of 'sym_tensor' function */
+
+      /* Convert to full tensor function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (tensor<Type>) tensor with same elements.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr operator tensor<Type>( void ) const noexcept
+      {
+        return tensor<Type>(
+          XX, XY, XZ,
+          XY, YY, YZ,
+          XZ, YZ, ZZ);
+      } /* End of 'operator tensor' function */
+
+      /* Add symmetric tensor function.
+       * ARGUMENTS:
+       *   - tensor to add:
+       *       const sym_tensor &S;
+       * RETURNS:
+       *   (sym_tensor) result tensor.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor operator+( const sym_tensor &S ) const noexcept
+      {
+        return sym_tensor(XX + S.XX, YY + S.YY, ZZ + S.ZZ, XY + S.XY, XZ + S.XZ, YZ + S.YZ);
+      } /* End of 'operator+' function */
+
+      /* Add symmetric tensor to current function.
+       * ARGUMENTS:
+       *   - tensor to add:
+       *       const sym_tensor &S;
+       * RETURNS:
+       *   (sym_tensor &) self reference.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor & operator+=( const sym_tensor &S ) noexcept
+      {
+        XX += S.XX, YY += S.YY, ZZ += S.ZZ;
+        XY += S.XY, XZ += S.XZ, YZ += S.YZ;
+        return *this;
+      } /* End of 'operator+=' function */
+
+      /* Subtract symmetric tensor function.
+       * ARGUMENTS:
+       *   - tensor to subtract:
+       *       const sym_tensor &S;
+       * RETURNS:
+       *   (sym_tensor) result tensor.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor operator-( const sym_tensor &S ) const noexcept
+      {
+        return sym_tensor(XX - S.XX, YY - S.YY, ZZ - S.ZZ, XY - S.XY, XZ - S.XZ, YZ - S.YZ);
+      } /* End of 'operator-' function */
+
+      /* Multiply by number function.
+       * ARGUMENTS:
+       *   - number to multiply by:
+       *       const Type N;
+       * RETURNS:
+       *   (sym_tensor) result tensor.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor operator*( const Type N ) const noexcept
+      {
+        return sym_tensor(XX * N, YY * N, ZZ * N, XY * N, XZ * N, YZ * N);
+      } /* End of 'operator*' function */
+
+      /* Multiply symmetric tensor by vec3 function.
+       * Same as row or column vector product by symmetry.
+       * ARGUMENTS:
+       *   - source vector:
+       *       const vec3<Type> &V;
+       * RETURNS:
+       *   (vec3<Type>) result vector.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr vec3<Type> operator*( const vec3<Type> &V ) const noexcept
+      {
+        return vec3<Type>(
+          XX * V.X + XY * V.Y + XZ * V.Z,
+          XY * V.X + YY * V.Y + YZ * V.Z,
+          XZ * V.X + YZ * V.Y + ZZ * V.Z);
+      } /* End of 'operator*' function */
+
+      /* Get quadratic form value function.
+       * ARGUMENTS:
+       *   - vector:
+       *       const vec3<Type> &V;
+       * RETURNS:
+       *   (Type) V^T * S * V.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Quadratic( const vec3<Type> &V ) const noexcept
+      {
+        return
+          XX * V.X * V.X + YY * V.Y * V.Y + ZZ * V.Z * V.Z +
+          2 * (XY * V.X * V.Y + XZ * V.X * V.Z + YZ * V.Y * V.Z);
+      } /* End of 'Quadratic' function */
+
+      /* Get trace function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (Type) sum of diagonal elements.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type Trace( void ) const noexcept
+      {
+        return XX + YY + ZZ;
+      } /* End of 'Trace' function */
+
+      /* Get determinant function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (Type) determinant.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type operator!( void ) const noexcept
+      {
+        return
+          XX * (YY * ZZ - YZ * YZ) +
+          XY * (YZ * XZ - XY * ZZ) +
+          XZ * (XY * YZ - YY * XZ);
+      } /* End of 'operator!' function */
+
+      /* Obtain identity tensor function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (sym_tensor) identity tensor.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static sym_tensor Identity( void ) noexcept
+      {
+        return sym_tensor(1, 1, 1, 0, 0, 0);
+      } /* End of 'Identity' function */
+
+      /* Inverse symmetric tensor function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (sym_tensor) inversed tensor (identity for singular one).
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor Inverse( void ) const noexcept
+      {
+        const Type
+          Cxx = YY * ZZ - YZ * YZ,
+          Cxy = YZ * XZ - XY * ZZ,
+          Cxz = XY * YZ - YY * XZ,
+          Det = XX * Cxx + XY * Cxy + XZ * Cxz;
+
+        if (Det == 0)
+          return Identity();
+
+        const Type RevDet = 1 / Det;
+
+        return sym_tensor(
+          Cxx * RevDet,
+          (XX * ZZ - XZ * XZ) * RevDet,
+          (XX * YY - XY * XY) * RevDet,
+          Cxy * RevDet,
+          Cxz * RevDet,
+          (XY * XZ - XX * YZ) * RevDet);
+      } /* End of 'Inverse' function */
+
+      /* Similarity transform function.
+       * Only 6 elements of result are evaluated (45 multiplications
+       * instead of 54 for two full tensor products).
+       * ARGUMENTS:
+       *   - transform tensor:
+       *       const tensor<Type> &R;
+       * RETURNS:
+       *   (sym_tensor) R * S * R^T.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor Transform( const tensor<Type> &R ) const noexcept
+      {
+        Type T[3][3]; // R * S
+
+        for (int i = 0; i < 3; i++)
+        {
+          T[i][0] = R[i][0] * XX + R[i][1] * XY + R[i][2] * XZ;
+          T[i][1] = R[i][0] * XY + R[i][1] * YY + R[i][2] * YZ;
+          T[i][2] = R[i][0] * XZ + R[i][1] * YZ + R[i][2] * ZZ;
+        }
+        return sym_tensor(
+          T[0][0] * R[0][0] + T[0][1] * R[0][1] + T[0][2] * R[0][2],
+          T[1][0] * R[1][0] + T[1][1] * R[1][1] + T[1][2] * R[1][2],
+          T[2][0] * R[2][0] + T[2][1] * R[2][1] + T[2][2] * R[2][2],
+          T[0][0] * R[1][0] + T[0][1] * R[1][1] + T[0][2] * R[1][2],
+          T[0][0] * R[2][0] + T[0][1] * R[2][1] + T[0][2] * R[2][2],
+          T[1][0] * R[2][0] + T[1][1] * R[2][1] + T[1][2] * R[2][2]);
+      } /* End of 'Transform' function */
+
+      /* Rotate symmetric tensor function.
+       * Tensor is rotated together with vectors transformed by
+       * 'Q.RotateTensor()' (e.g. body to world inertia tensor), so
+       * Q.RotateTensor().Transpose() is passed to 'Transform'.
+       * ARGUMENTS:
+       *   - rotation quaternion:
+       *       const quat<Type> &Q;
+       * RETURNS:
+       *   (sym_tensor) rotated tensor.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr sym_tensor Rotate( const quat<Type> &Q ) const noexcept
+      {
+        return Transform(Q.RotateTensor().Transpose());
+      } /* End of 'Rotate' function */
+
+      /* Symmetric eigen decomposition function (see 'tensor::Eigen').
+       * ARGUMENTS:
+       *   - rotation taking coordinate axes to eigenvectors:
+       *       quat<Type> &Rotation;
+       * RETURNS:
+       *   (vec3<Type>) eigenvalues in ascending order.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr vec3<Type> Eigen( quat<Type> &Rotation ) const noexcept
+      {
+        return tensor<Type>(*this).Eigen(Rotation);
+      } /* End of 'Eigen' function */
+
+    }; /* End of 'sym_tensor' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_sym_tensor_h_ */
+
+/* END OF 'mth_sym_tensor.h' FILE */
@@ -1,13 +1,17 @@
 /***************************************************************
  * FILE NAME   : mth_tensor.h
  * PURPOSE     : Tensor class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_tensor_h_
 #define __mth_tensor_h_
 
+#include <limits>
+
 #include "mth_def.h"
+#include "mth_simd.h"
+#include "mth_parallel.h"
 
 /* Math namespace */
 namespace mth
@@ -15,12 +19,14 @@ namespace mth
   /* Forward declaration */
   template<typename Type>
     class vec3;
+  template<typename Type>
+    class quat;
 
   /* Matrix 3x3 representation type */
   template<typename Type>
     class tensor
     {
-      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in tensor");
+      static_assert(number<Type>, "Number type is needed in tensor");
 
       template<typename Type2>
         friend class matr;
@@ -28,6 +34,8 @@ namespace mth
       Type A[3][3] = {};
 
     public:
+      static const int JACOBI_SWEEPS = std::is_same_v<Type, FLT> ? 4 : 5; // Jacobi sweeps for all lanes convergence
+      static const int SVD_SWEEPS = std::is_same_v<Type, FLT> ? 6 : 8;    // Approximate Givens sweeps in 'Svd'
 
       /* Class default constructor */
 #ifdef __CUDA__
@@ -100,6 +108,36 @@ namespace mth
         A[2][2] = T.A[2][2];
       } /* End of 'tensor' function */
 
+      /* Get tensor row function.
+       * ARGUMENTS:
+       *   - row index:
+       *       const UINT N;
+       * RETURNS:
+       *   (const Type *) row elements.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr const Type * operator[]( const UINT N ) const noexcept
+      {
+        return A[N];
+      } /* End of 'operator[]' function */
+
+      /* Get tensor row reference function.
+       * ARGUMENTS:
+       *   - row index:
+       *       const UINT N;
+       * RETURNS:
+       *   (Type *) row elements.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr Type * operator[]( const UINT N ) noexcept
+      {
+        return A[N];
+      } /* End of 'operator[]' function */
+
       /* Add to tensor function.
        * ARGUMENTS:
        *   - source tensor:
@@ -284,7 +322,7 @@ namespace mth
         const Type RevDet = 1 / det;
         return tensor{
           (A[1][1] * A[2][2] - A[1][2] * A[2][1]) * RevDet,
-          (A[0][2] * A[2][1] - A[0][1] * A[2][1]) * RevDet,
+          (A[0][2] * A[2][1] - A[0][1] * A[2][2]) * RevDet,
           (A[0][1] * A[1][2] - A[0][2] * A[1][1]) * RevDet,
           (A[1][2] * A[2][0] - A[1][0] * A[2][2]) * RevDet,
           (A[0][0] * A[2][2] - A[0][2] * A[2][0]) * RevDet,
@@ -313,6 +351,604 @@ namespace mth
           -W[1], W[0], 0);
       } /* End of 'Star' function */
 
+      /* Symmetric eigen decomposition by cyclic Jacobi rotations function.
+       * Lane generic: 'Lane' is 'Type' or 'simd<Type, N>', all lanes run
+       * the same rotations sequence (no branches on data). Eigenvalues
+       * are sorted ascending, eigenvectors columns form rotation
+       * (determinant is 1), so S = V * diag(S) * V^T on exit.
+       * ARGUMENTS:
+       *   - symmetric matrix (diagonal holds eigenvalues on exit):
+       *       Lane S[3][3];
+       *   - eigenvectors (columns):
+       *       Lane V[3][3];
+       *   - maximal number of sweeps:
+       *       const int MaxSweeps = JACOBI_SWEEPS;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr static void Jacobi( Lane S[3][3], Lane V[3][3], const int MaxSweeps = JACOBI_SWEEPS ) noexcept
+        {
+          constexpr Type Eps2 = std::numeric_limits<Type>::epsilon() * std::numeric_limits<Type>::epsilon();
+          constexpr int P[3] = {0, 0, 1}, Q[3] = {1, 2, 2};
+
+          for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+              V[i][j] = Lane(i == j ? 1 : 0);
+
+          for (int Sweep = 0; Sweep < MaxSweeps; Sweep++)
+          {
+            const Lane
+              Off = S[0][1] * S[0][1] + S[0][2] * S[0][2] + S[1][2] * S[1][2],
+              Diag = S[0][0] * S[0][0] + S[1][1] * S[1][1] + S[2][2] * S[2][2];
+            const auto IsDone = Off <= Diag * Lane(Eps2);
+
+            if constexpr (std::is_same_v<std::remove_cv_t<decltype(IsDone)>, bool>)
+            {
+              if (IsDone)
+                break;
+            }
+            else if (IsDone.All())
+              break;
+
+            for (int k = 0; k < 3; k++)
+            {
+              const int p = P[k], q = Q[k], r = 3 - p - q;
+              const Lane Apq = S[p][q];
+              const auto IsZero = Apq == Lane(0);
+              const Lane
+                Theta = (S[q][q] - S[p][p]) / (Lane(2) * Select(IsZero, Lane(1), Apq)),
+                T = Select(IsZero, Lane(0),
+                      Select(Theta < Lane(0), Lane(-1), Lane(1)) / (Abs(Theta) + Sqrt(Theta * Theta + Lane(1)))),
+                C = Lane(1) / Sqrt(T * T + Lane(1)),
+                Sn = T * C,
+                Arp = S[r][p],
+                Arq = S[r][q];
+
+              S[p][p] -= T * Apq;
+              S[q][q] += T * Apq;
+              S[p][q] = S[q][p] = Lane(0);
+              S[r][p] = S[p][r] = C * Arp - Sn * Arq;
+              S[r][q] = S[q][r] = Sn * Arp + C * Arq;
+              for (int i = 0; i < 3; i++)
+              {
+                const Lane Vip = V[i][p], Viq = V[i][q];
+
+                V[i][p] = C * Vip - Sn * Viq;
+                V[i][q] = Sn * Vip + C * Viq;
+              }
+            }
+          }
+
+          /* Sort network, swapped columns keep rotation by negating one of them */
+          constexpr int SortA[3] = {0, 1, 0}, SortB[3] = {1, 2, 1};
+
+          for (int k = 0; k < 3; k++)
+          {
+            const int a = SortA[k], b = SortB[k];
+            const auto IsSwap = S[b][b] < S[a][a];
+            const Lane Sa = S[a][a];
+
+            S[a][a] = Select(IsSwap, S[b][b], Sa);
+            S[b][b] = Select(IsSwap, Sa, S[b][b]);
+            for (int i = 0; i < 3; i++)
+            {
+              const Lane Va = V[i][a];
+
+              V[i][a] = Select(IsSwap, V[i][b], Va);
+              V[i][b] = Select(IsSwap, -Va, V[i][b]);
+            }
+          }
+        } /* End of 'Jacobi' function */
+
+      /* Symmetric eigen decomposition function.
+       * Symmetric part of tensor is decomposed.
+       * ARGUMENTS:
+       *   - eigenvectors tensor (rows are unit eigenvectors, forms rotation):
+       *       tensor &Vectors;
+       * RETURNS:
+       *   (vec3<Type>) eigenvalues in ascending order.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr vec3<Type> Eigen( tensor &Vectors ) const noexcept
+      {
+        Type S[3][3], V[3][3];
+
+        for (int i = 0; i < 3; i++)
+          for (int j = 0; j < 3; j++)
+            S[i][j] = (A[i][j] + A[j][i]) / 2;
+        Jacobi(S, V);
+        for (int i = 0; i < 3; i++)
+          for (int j = 0; j < 3; j++)
+            Vectors.A[i][j] = V[j][i];
+        return vec3<Type>(S[0][0], S[1][1], S[2][2]);
+      } /* End of 'Eigen' function */
+
+      /* Symmetric eigen decomposition with rotation quaternion function.
+       * ARGUMENTS:
+       *   - rotation taking coordinate axes to eigenvectors (see 'quat::RotateTensor'):
+       *       quat<Type> &Rotation;
+       * RETURNS:
+       *   (vec3<Type>) eigenvalues in ascending order.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr vec3<Type> Eigen( quat<Type> &Rotation ) const noexcept
+      {
+        tensor Vectors;
+        const vec3<Type> Values = Eigen(Vectors);
+
+        Rotation = quat<Type>(Vectors);
+        return Values;
+      } /* End of 'Eigen' function */
+
+      /* Symmetric eigen decomposition for tensors array function.
+       * Tensors are processed by N lanes packs in parallel threads.
+       * ARGUMENTS:
+       *   - tensors array:
+       *       const tensor *T;
+       *   - eigenvalues array (ascending):
+       *       vec3<Type> *Values;
+       *   - eigenvectors tensors array (rows are eigenvectors):
+       *       tensor *Vectors;
+       *   - number of tensors:
+       *       const int Num;
+       * RETURNS: None.
+       */
+      template<int N = 8>
+        static void Eigen( const tensor *T, vec3<Type> *Values, tensor *Vectors, const int Num )
+        {
+          parallel::For(0, (Num + N - 1) / N,
+            [&]( const int Begin, const int End, const int )
+            {
+              for (int b = Begin; b < End; b++)
+              {
+                const int
+                  First = b * N,
+                  Size = Num - First < N ? Num - First : N;
+                simd<Type, N> S[3][3], V[3][3];
+
+                for (int i = 0; i < 3; i++)
+                  for (int j = 0; j < 3; j++)
+                    for (int l = 0; l < N; l++)
+                      S[i][j].V[l] = l < Size ? (T[First + l].A[i][j] + T[First + l].A[j][i]) / 2 : 0;
+                Jacobi(S, V);
+                for (int l = 0; l < Size; l++)
+                {
+                  for (int i = 0; i < 3; i++)
+                    for (int j = 0; j < 3; j++)
+                      Vectors[First + l].A[i][j] = V[j][i].V[l];
+                  Values[First + l] = vec3<Type>(S[0][0].V[l], S[1][1].V[l], S[2][2].V[l]);
+                }
+              }
+            }, 256 / N);
+        } /* End of 'Eigen' function */
+
+      /* Singular value decomposition function (McAdams et al. style).
+       * Lane generic and branch free with bounded iteration count:
+       * Jacobi sweeps with approximate Givens rotations diagonalize A^T * A
+       * accumulating V as quaternion, columns of A * V are sorted by norm
+       * and Givens QR factorization gives U (quaternion) and singular
+       * values. A = U * diag(Sigma) * V^T for U, V as column rotation
+       * matrices (i.e. 'quat::RotateTensor().Transpose()'). Sigma is
+       * sorted by absolute value descending, last one is negative for
+       * reflections, so U and V are always rotations.
+       * ARGUMENTS:
+       *   - source matrix:
+       *       const Lane A[3][3];
+       *   - left rotation quaternion (X, Y, Z, W):
+       *       Lane U[4];
+       *   - singular values:
+       *       Lane Sigma[3];
+       *   - right rotation quaternion (X, Y, Z, W):
+       *       Lane V[4];
+       *   - number of Jacobi sweeps:
+       *       const int Sweeps = SVD_SWEEPS;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr static void Svd( const Lane A[3][3], Lane U[4], Lane Sigma[3], Lane V[4], const int Sweeps = SVD_SWEEPS ) noexcept
+        {
+          constexpr Type
+            Gamma = 5.82842712474619009760, // 3 + 2 * sqrt(2)
+            CosPi8 = 0.92387953251128675613,
+            SinPi8 = 0.38268343236508977173,
+            Sqrt1_2 = 0.70710678118654752440,
+            Eps = std::numeric_limits<Type>::epsilon() * std::numeric_limits<Type>::epsilon();
+          constexpr int P[3] = {0, 0, 1}, Q[3] = {1, 2, 2};
+          Lane S[3][3], B[3][3];
+
+          /* Symmetric eigen problem for A^T * A */
+          for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+              S[i][j] = A[0][i] * A[0][j] + A[1][i] * A[1][j] + A[2][i] * A[2][j];
+          V[0] = V[1] = V[2] = Lane(0);
+          V[3] = Lane(1);
+          for (int Sweep = 0; Sweep < Sweeps; Sweep++)
+            for (int k = 0; k < 3; k++)
+            {
+              const int p = P[k], q = Q[k], r = 3 - p - q;
+              /* Negligible off diagonal element is skipped (also avoids denormals in later sweeps) */
+              const auto IsSkip = Abs(S[p][q]) <= Lane(std::numeric_limits<Type>::epsilon()) * (Abs(S[p][p]) + Abs(S[q][q]));
+              Lane
+                Ch = Select(IsSkip, Lane(1), Lane(2) * (S[p][p] - S[q][q])),
+                Sh = Select(IsSkip, Lane(0), S[p][q]);
+              const auto IsApprox = Lane(Gamma) * Sh * Sh < Ch * Ch;
+              const Lane W = Lane(1) / Sqrt(Select(IsApprox, Ch * Ch + Sh * Sh, Lane(1)));
+
+              Ch = Select(IsApprox, W * Ch, Lane(CosPi8));
+              Sh = Select(IsApprox, W * Sh, Lane(SinPi8));
+
+              const Lane
+                C = Ch * Ch - Sh * Sh,
+                Sn = Lane(2) * Ch * Sh,
+                Spp = S[p][p], Sqq = S[q][q], Spq = S[p][q],
+                Srp = S[r][p], Srq = S[r][q];
+
+              S[p][p] = C * C * Spp + Lane(2) * C * Sn * Spq + Sn * Sn * Sqq;
+              S[q][q] = Sn * Sn * Spp - Lane(2) * C * Sn * Spq + C * C * Sqq;
+              S[p][q] = S[q][p] = Select(IsSkip, Lane(0), C * Sn * (Sqq - Spp) + (C * C - Sn * Sn) * Spq);
+              S[r][p] = S[p][r] = C * Srp + Sn * Srq;
+              S[r][q] = S[q][r] = C * Srq - Sn * Srp;
+              QuatMulAxis(V, r, p < r && r < q ? -Sh : Sh, Ch);
+            }
+
+          /* Remove rounding drift of accumulated rotation */
+          const Lane Norm = Lane(1) / Sqrt(V[0] * V[0] + V[1] * V[1] + V[2] * V[2] + V[3] * V[3]);
+
+          for (int i = 0; i < 4; i++)
+            V[i] *= Norm;
+
+          /* B = A * V, columns sorted by norm descending */
+          Lane M[3][3];
+
+          QuatColumns(V, M);
+          for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+              B[i][j] = A[i][0] * M[0][j] + A[i][1] * M[1][j] + A[i][2] * M[2][j];
+
+          constexpr int SortA[3] = {0, 0, 1}, SortB[3] = {1, 2, 2};
+
+          for (int k = 0; k < 3; k++)
+          {
+            const int a = SortA[k], b = SortB[k], r = 3 - a - b;
+            const auto IsSwap =
+              B[0][a] * B[0][a] + B[1][a] * B[1][a] + B[2][a] * B[2][a] <
+              B[0][b] * B[0][b] + B[1][b] * B[1][b] + B[2][b] * B[2][b];
+
+            for (int i = 0; i < 3; i++)
+            {
+              const Lane Ba = B[i][a];
+
+              B[i][a] = Select(IsSwap, B[i][b], Ba);
+              B[i][b] = Select(IsSwap, -Ba, B[i][b]);
+            }
+            QuatMulAxis(V, r, Select(IsSwap, Lane(a < r && r < b ? -Sqrt1_2 : Sqrt1_2), Lane(0)), Select(IsSwap, Lane(Sqrt1_2), Lane(1)));
+          }
+
+          /* Givens QR: B = U * R */
+          U[0] = U[1] = U[2] = Lane(0);
+          U[3] = Lane(1);
+          for (int k = 0; k < 3; k++)
+          {
+            const int p = P[k], q = Q[k], r = 3 - p - q;
+            const Lane
+              A1 = B[p][p],
+              A2 = B[q][p],
+              Rho = Sqrt(A1 * A1 + A2 * A2);
+            Lane
+              Sh = Select(Rho * Rho > Lane(Eps), A2, Lane(0)),
+              Ch = Abs(A1) + Max(Rho, Lane(Eps));
+            const auto IsNeg = A1 < Lane(0);
+            const Lane T = Sh;
+
+            Sh = Select(IsNeg, Ch, Sh);
+            Ch = Select(IsNeg, T, Ch);
+
+            const Lane W = Lane(1) / Sqrt(Ch * Ch + Sh * Sh);
+
+            Ch *= W;
+            Sh *= W;
+
+            const Lane
+              C = Ch * Ch - Sh * Sh,
+              Sn = Lane(2) * Ch * Sh;
+
+            for (int j = 0; j < 3; j++)
+            {
+              const Lane Bp = B[p][j], Bq = B[q][j];
+
+              B[p][j] = C * Bp + Sn * Bq;
+              B[q][j] = C * Bq - Sn * Bp;
+            }
+            QuatMulAxis(U, r, p < r && r < q ? -Sh : Sh, Ch);
+          }
+          Sigma[0] = B[0][0];
+          Sigma[1] = B[1][1];
+          Sigma[2] = B[2][2];
+        } /* End of 'Svd' function */
+
+      /* Singular value decomposition function.
+       * ARGUMENTS:
+       *   - left and right rotations (tensor == U * diag(Sigma) * V.Transpose()):
+       *       tensor &U, &V;
+       * RETURNS:
+       *   (vec3<Type>) singular values (see lanes 'Svd').
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr vec3<Type> Svd( tensor &U, tensor &V ) const noexcept
+      {
+        Type Qu[4], Qv[4], Sigma[3];
+
+        Svd(A, Qu, Sigma, Qv);
+        QuatColumns(Qu, U.A);
+        QuatColumns(Qv, V.A);
+        return vec3<Type>(Sigma[0], Sigma[1], Sigma[2]);
+      } /* End of 'Svd' function */
+
+      /* Singular value decomposition with rotation quaternions function.
+       * ARGUMENTS:
+       *   - left and right rotations
+       *     (tensor == U.RotateTensor().Transpose() * diag(Sigma) * V.RotateTensor()):
+       *       quat<Type> &U, &V;
+       * RETURNS:
+       *   (vec3<Type>) singular values (see lanes 'Svd').
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr vec3<Type> Svd( quat<Type> &U, quat<Type> &V ) const noexcept
+      {
+        Type Qu[4], Qv[4], Sigma[3];
+
+        Svd(A, Qu, Sigma, Qv);
+        U = quat<Type>(Qu[0], Qu[1], Qu[2], Qu[3]);
+        V = quat<Type>(Qv[0], Qv[1], Qv[2], Qv[3]);
+        return vec3<Type>(Sigma[0], Sigma[1], Sigma[2]);
+      } /* End of 'Svd' function */
+
+      /* Polar decomposition function.
+       * Tensor is split to rotation and symmetric stretch:
+       * tensor == R * S, R = U * V^T, S = V * diag(Sigma) * V^T.
+       * ARGUMENTS:
+       *   - rotation (column rotation matrix):
+       *       tensor &R;
+       *   - symmetric stretch:
+       *       tensor &S;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr void PolarDecompose( tensor &R, tensor &S ) const noexcept
+      {
+        Type Qu[4], Qv[4], Sigma[3];
+
+        Svd(A, Qu, Sigma, Qv);
+        Polar(Qu, Sigma, Qv, R.A, S.A);
+      } /* End of 'PolarDecompose' function */
+
+      /* Polar decomposition with rotation quaternion function.
+       * ARGUMENTS:
+       *   - rotation (tensor == R.RotateTensor().Transpose() * S):
+       *       quat<Type> &R;
+       *   - symmetric stretch:
+       *       tensor &S;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr void PolarDecompose( quat<Type> &R, tensor &S ) const noexcept
+      {
+        Type Qu[4], Qv[4], Sigma[3], M[3][3];
+
+        Svd(A, Qu, Sigma, Qv);
+        Polar(Qu, Sigma, Qv, M, S.A);
+        R = quat<Type>(Qu[0], Qu[1], Qu[2], Qu[3]) * quat<Type>(-Qv[0], -Qv[1], -Qv[2], Qv[3]);
+      } /* End of 'PolarDecompose' function */
+
+      /* Singular value decomposition for tensors array function.
+       * Tensors are processed by N lanes packs in parallel threads.
+       * ARGUMENTS:
+       *   - tensors array:
+       *       const tensor *T;
+       *   - left rotations array:
+       *       tensor *U;
+       *   - singular values array:
+       *       vec3<Type> *Sigma;
+       *   - right rotations array:
+       *       tensor *V;
+       *   - number of tensors:
+       *       const int Num;
+       * RETURNS: None.
+       */
+      template<int N = 8>
+        static void Svd( const tensor *T, tensor *U, vec3<Type> *Sigma, tensor *V, const int Num )
+        {
+          ForPacks<N>(T, Num,
+            [&]( const int First, const int Size, const simd<Type, N> *Qu, const simd<Type, N> *S, const simd<Type, N> *Qv )
+            {
+              simd<Type, N> Mu[3][3], Mv[3][3];
+
+              QuatColumns(Qu, Mu);
+              QuatColumns(Qv, Mv);
+              for (int l = 0; l < Size; l++)
+              {
+                Store(Mu, l, U[First + l]);
+                Store(Mv, l, V[First + l]);
+                Sigma[First + l] = vec3<Type>(S[0].V[l], S[1].V[l], S[2].V[l]);
+              }
+            });
+        } /* End of 'Svd' function */
+
+      /* Polar decomposition for tensors array function.
+       * Tensors are processed by N lanes packs in parallel threads.
+       * ARGUMENTS:
+       *   - tensors array:
+       *       const tensor *T;
+       *   - rotations array:
+       *       tensor *R;
+       *   - symmetric stretches array:
+       *       tensor *S;
+       *   - number of tensors:
+       *       const int Num;
+       * RETURNS: None.
+       */
+      template<int N = 8>
+        static void PolarDecompose( const tensor *T, tensor *R, tensor *S, const int Num )
+        {
+          ForPacks<N>(T, Num,
+            [&]( const int First, const int Size, const simd<Type, N> *Qu, const simd<Type, N> *Sigma, const simd<Type, N> *Qv )
+            {
+              simd<Type, N> Mr[3][3], Ms[3][3];
+
+              Polar(Qu, Sigma, Qv, Mr, Ms);
+              for (int l = 0; l < Size; l++)
+              {
+                Store(Mr, l, R[First + l]);
+                Store(Ms, l, S[First + l]);
+              }
+            });
+        } /* End of 'PolarDecompose' function */
+
+    private:
+      /* Multiply lanes quaternion by rotation around coordinate axis function.
+       * ARGUMENTS:
+       *   - quaternion (X, Y, Z, W):
+       *       Lane Q[4];
+       *   - axis index:
+       *       const int K;
+       *   - half angle sine and cosine:
+       *       const Lane &Sh, &Ch;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr static void QuatMulAxis( Lane Q[4], const int K, const Lane &Sh, const Lane &Ch ) noexcept
+        {
+          const int I = (K + 1) % 3, J = (K + 2) % 3;
+          const Lane Qi = Q[I], Qj = Q[J], Qk = Q[K], Qw = Q[3];
+
+          Q[I] = Ch * Qi + Sh * Qj;
+          Q[J] = Ch * Qj - Sh * Qi;
+          Q[K] = Ch * Qk + Sh * Qw;
+          Q[3] = Ch * Qw - Sh * Qk;
+        } /* End of 'QuatMulAxis' function */
+
+      /* Build column rotation matrix by lanes quaternion function.
+       * ARGUMENTS:
+       *   - unit quaternion (X, Y, Z, W):
+       *       const Lane Q[4];
+       *   - rotation matrix (transposed 'quat::RotateTensor'):
+       *       Lane M[3][3];
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr static void QuatColumns( const Lane Q[4], Lane M[3][3] ) noexcept
+        {
+          const Lane
+            X2 = Lane(2) * Q[0] * Q[0], Y2 = Lane(2) * Q[1] * Q[1], Z2 = Lane(2) * Q[2] * Q[2],
+            XY = Lane(2) * Q[0] * Q[1], XZ = Lane(2) * Q[0] * Q[2], YZ = Lane(2) * Q[1] * Q[2],
+            WX = Lane(2) * Q[3] * Q[0], WY = Lane(2) * Q[3] * Q[1], WZ = Lane(2) * Q[3] * Q[2];
+
+          M[0][0] = Lane(1) - Y2 - Z2, M[0][1] = XY - WZ,            M[0][2] = XZ + WY;
+          M[1][0] = XY + WZ,            M[1][1] = Lane(1) - X2 - Z2, M[1][2] = YZ - WX;
+          M[2][0] = XZ - WY,            M[2][1] = YZ + WX,            M[2][2] = Lane(1) - X2 - Y2;
+        } /* End of 'QuatColumns' function */
+
+      /* Build polar decomposition by singular value decomposition function.
+       * ARGUMENTS:
+       *   - left rotation quaternion, singular values, right rotation quaternion:
+       *       const Lane U[4], Sigma[3], V[4];
+       *   - rotation and symmetric stretch:
+       *       Lane R[3][3], S[3][3];
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      template<typename Lane>
+        constexpr static void Polar( const Lane U[4], const Lane Sigma[3], const Lane V[4], Lane R[3][3], Lane S[3][3] ) noexcept
+        {
+          Lane Mu[3][3], Mv[3][3];
+
+          QuatColumns(U, Mu);
+          QuatColumns(V, Mv);
+          for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+            {
+              R[i][j] = Mu[i][0] * Mv[j][0] + Mu[i][1] * Mv[j][1] + Mu[i][2] * Mv[j][2];
+              S[i][j] = Mv[i][0] * Sigma[0] * Mv[j][0] + Mv[i][1] * Sigma[1] * Mv[j][1] + Mv[i][2] * Sigma[2] * Mv[j][2];
+            }
+        } /* End of 'Polar' function */
+
+      /* Store lane of lanes matrix to tensor function.
+       * ARGUMENTS:
+       *   - lanes matrix:
+       *       const simd<Type, N> M[3][3];
+       *   - lane index:
+       *       const int L;
+       *   - destination tensor:
+       *       tensor &T;
+       * RETURNS: None.
+       */
+      template<int N>
+        static void Store( const simd<Type, N> M[3][3], const int L, tensor &T ) noexcept
+        {
+          for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++)
+              T.A[i][j] = M[i][j].V[L];
+        } /* End of 'Store' function */
+
+      /* Run lanes singular value decomposition over tensors array function.
+       * ARGUMENTS:
+       *   - tensors array:
+       *       const tensor *T;
+       *   - number of tensors:
+       *       const int Num;
+       *   - pack result processing function (called as F(First, Size, U, Sigma, V)):
+       *       const Func &F;
+       * RETURNS: None.
+       */
+      template<int N, typename Func>
+        static void ForPacks( const tensor *T, const int Num, const Func &F )
+        {
+          parallel::For(0, (Num + N - 1) / N,
+            [&]( const int Begin, const int End, const int )
+            {
+              for (int b = Begin; b < End; b++)
+              {
+                const int
+                  First = b * N,
+                  Size = Num - First < N ? Num - First : N;
+                simd<Type, N> M[3][3], U[4], Sigma[3], V[4];
+
+                for (int i = 0; i < 3; i++)
+                  for (int j = 0; j < 3; j++)
+                    for (int l = 0; l < N; l++)
+                      M[i][j].V[l] = l < Size ? T[First + l].A[i][j] : 0;
+                Svd(M, U, Sigma, V);
+                F(First, Size, U, Sigma, V);
+              }
+            }, 256 / N);
+        } /* End of 'ForPacks' function */
+
     }; /* End of 'tensor' class */
 } /* end of 'mth' namespace */
 
@@ -0,0 +1,217 @@
+/***************************************************************
+ * FILE NAME   : mth_tri_block.h
+ * PURPOSE     : Triangles block class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_tri_block_h_
+#define __mth_tri_block_h_
+
+#include <limits>
+
+#include "mth_def.h"
+#include "mth_simd.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class ray;
+
+  /* Triangles block class (structure of arrays, one triangle per lane).
+   * Block of 8 FLT triangles is tested against one ray by single AVX pass.
+   */
+  template<typename Type, int N = 8>
+    class tri_block
+    {
+      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in tri_block");
+
+    public:
+      static const int SIZE = N;
+
+      /* Block intersection result representation type */
+      struct hit
+      {
+        Type T;    /* Distance to intersection (must be set to maximal distance before search) */
+        Type U, V; /* Intersection barycentric coordinates (weights of V1 and V2) */
+        int Index; /* Triangle index (block index * N + lane) */
+      }; /* End of 'hit' structure */
+
+      simd<Type, N>
+        V0[3], // Triangles first vertices components (0 - 'x', 1 - 'y', 2 - 'z')
+        E1[3], // Triangles first edges (V1 - V0) components
+        E2[3]; // Triangles second edges (V2 - V0) components
+
+      /* Class default constructor (all lanes are empty) */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr tri_block( void ) noexcept : V0{}, E1{}, E2{}
+      {
+      } /* End of 'tri_block' function */
+
+      /* Set lane triangle function.
+       * ARGUMENTS:
+       *   - lane index:
+       *       const int Lane;
+       *   - triangle vertices:
+       *       const vec3<Type> &P0, &P1, &P2;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr void Set( const int Lane, const vec3<Type> &P0, const vec3<Type> &P1, const vec3<Type> &P2 ) noexcept
+      {
+        for (int i = 0; i < 3; i++)
+        {
+          V0[i][Lane] = P0[i];
+          E1[i][Lane] = P1[i] - P0[i];
+          E2[i][Lane] = P2[i] - P0[i];
+        }
+      } /* End of 'Set' function */
+
+      /* Clear lane triangle (lane never hits) function.
+       * ARGUMENTS:
+       *   - lane index:
+       *       const int Lane;
+       * RETURNS: None.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr void Clear( const int Lane ) noexcept
+      {
+        for (int i = 0; i < 3; i++)
+          V0[i][Lane] = E1[i][Lane] = E2[i][Lane] = 0;
+      } /* End of 'Clear' function */
+
+      /* Intersect ray with all block triangles function (Moller-Trumbore).
+       * ARGUMENTS:
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - maximal distance:
+       *       const Type TMax;
+       *   - lanes distances and barycentric coordinates (valid for hit lanes only):
+       *       simd<Type, N> &T, &U, &V;
+       * RETURNS:
+       *   (simd_mask<Type, N>) lanes hit mask.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr simd_mask<Type, N> Intersect( const ray<Type> &R, const Type TMax,
+                                              simd<Type, N> &T, simd<Type, N> &U, simd<Type, N> &V ) const noexcept
+      {
+        const simd<Type, N>
+          Dx(R.Dir.X), Dy(R.Dir.Y), Dz(R.Dir.Z),
+          Zero(0), One(1),
+          /* P = Dir x E2 */
+          Px = Dy * E2[2] - Dz * E2[1],
+          Py = Dz * E2[0] - Dx * E2[2],
+          Pz = Dx * E2[1] - Dy * E2[0],
+          Det = E1[0] * Px + E1[1] * Py + E1[2] * Pz,
+          RevDet = One / Select(Det != Zero, Det, One),
+          /* Tv = Org - V0 */
+          Tx = simd<Type, N>(R.Org.X) - V0[0],
+          Ty = simd<Type, N>(R.Org.Y) - V0[1],
+          Tz = simd<Type, N>(R.Org.Z) - V0[2],
+          /* Q = Tv x E1 */
+          Qx = Ty * E1[2] - Tz * E1[1],
+          Qy = Tz * E1[0] - Tx * E1[2],
+          Qz = Tx * E1[1] - Ty * E1[0];
+
+        U = (Tx * Px + Ty * Py + Tz * Pz) * RevDet;
+        V = (Dx * Qx + Dy * Qy + Dz * Qz) * RevDet;
+        T = (E2[0] * Qx + E2[1] * Qy + E2[2] * Qz) * RevDet;
+        return (Det != Zero) & (U >= Zero) & (V >= Zero) & (U + V <= One) & (T > Zero) & (T < simd<Type, N>(TMax));
+      } /* End of 'Intersect' function */
+
+      /* Intersect ray with triangles blocks array function.
+       * ARGUMENTS:
+       *   - triangles blocks array:
+       *       const tri_block *Blocks;
+       *   - number of blocks:
+       *       const int Count;
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - intersection result (T must be set to maximal distance, updated on hit):
+       *       hit &Hit;
+       *   - any hit (stop at first found hit, e.g. for shadow rays) flag:
+       *       const bool AnyHit = false;
+       * RETURNS:
+       *   (bool) true if hit found.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static bool IntersectArray( const tri_block *Blocks, const int Count, const ray<Type> &R, hit &Hit, const bool AnyHit = false ) noexcept
+      {
+        bool IsFound = false;
+
+        for (int i = 0; i < Count; i++)
+        {
+          simd<Type, N> T, U, V;
+          const simd_mask<Type, N> Mask = Blocks[i].Intersect(R, Hit.T, T, U, V);
+          UINT Bits = Mask.Bits();
+
+          if (Bits == 0)
+            continue;
+
+          /* Closest lane of block */
+          const Type TMin = Select(Mask, T, simd<Type, N>(Hit.T)).MinC();
+          int Lane = 0;
+
+          Bits &= (T == simd<Type, N>(TMin)).Bits();
+          while (!(Bits & 1))
+            Bits >>= 1, Lane++;
+          Hit.T = TMin;
+          Hit.U = U[Lane];
+          Hit.V = V[Lane];
+          Hit.Index = i * N + Lane;
+          IsFound = true;
+          if (AnyHit)
+            break;
+        }
+        return IsFound;
+      } /* End of 'IntersectArray' function */
+
+      /* Occlusion query with triangles blocks array function (stops at first hit).
+       * ARGUMENTS:
+       *   - triangles blocks array:
+       *       const tri_block *Blocks;
+       *   - number of blocks:
+       *       const int Count;
+       *   - ray to test:
+       *       const ray<Type> &R;
+       *   - distances range [TMin, TMax]:
+       *       const Type TMin, TMax;
+       * RETURNS:
+       *   (bool) true if ray is occluded.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr static bool Occluded( const tri_block *Blocks, const int Count, const ray<Type> &R, const Type TMin, const Type TMax ) noexcept
+      {
+        const simd<Type, N> Lo(TMin), Hi(TMax);
+
+        for (int i = 0; i < Count; i++)
+        {
+          simd<Type, N> T, U, V;
+
+          if ((Blocks[i].Intersect(R, std::numeric_limits<Type>::infinity(), T, U, V) & (T >= Lo) & (T <= Hi)).Any())
+            return true;
+        }
+        return false;
+      } /* End of 'Occluded' function */
+
+    }; /* End of 'tri_block' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_tri_block_h_ */
+
+/* END OF 'mth_tri_block.h' FILE */
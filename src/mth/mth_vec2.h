@@ -1,12 +1,13 @@
 /***************************************************************
  * FILE NAME   : mth_vec2.h
  * PURPOSE     : Vector 2D class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_vec2_h_
 #define __mth_vec2_h_
 
+#include <algorithm>
 #include <format>
 
 #include "mth_def.h"
@@ -24,7 +25,7 @@ namespace mth
   template<typename Type>
     class vec2
     {
-      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in vec2");
+      static_assert(number<Type>, "Number type is needed in vec2");
     public:
       Type X, Y;
 
@@ -94,6 +95,19 @@ namespace mth
       {
       } /* End of 'vec2' constructor */
 
+      /* Vector pointer cast function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (const Type *) result pointer.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr operator const Type *( void ) const noexcept
+      {
+        return &X;
+      } /* End of 'operator const Type *' function */
+
       /* Vector pointer cast function.
        * ARGUMENTS: None.
        * RETURNS:
@@ -102,10 +116,10 @@ namespace mth
 #ifdef __CUDA__
       __host__ __device__
 #endif /* __CUDA__ */
-      constexpr operator Type*( void ) const noexcept
+      constexpr operator Type *( void ) noexcept
       {
         return &X;
-      } /* End of 'operator Type*' function */
+      } /* End of 'operator Type *' function */
 
       /* Vector component getter function.
        * ARGUMENTS:
@@ -442,7 +456,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr Type MaxC( void ) const noexcept
       {
-        return max(X, Y);
+        return std::max(X, Y);
       } /* End of 'MaxC' function */
 
       /* Get vector minimal component function.
@@ -455,7 +469,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr Type MinC( void ) const noexcept
       {
-        return min(X, Y);
+        return std::min(X, Y);
       } /* End of 'MinC' function */
 
       /* Get distance between vectors' ends function.
@@ -488,8 +502,8 @@ namespace mth
       constexpr vec2 Lerp( const vec2 &V, const Type T ) const noexcept
       {
         return vec2(
-          std::lerp(X, V.X, T),
-          std::lerp(Y, V.Y, T));
+          X + (V.X - X) * T,
+          Y + (V.Y - Y) * T);
       } /* End of 'Lerp' function */
 
       /* Maximal vector function.
@@ -504,7 +518,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec2 Max( const vec2 &V ) const noexcept
       {
-        return vec2(max(V.X, X), max(V.Y, Y));
+        return vec2(std::max(V.X, X), std::max(V.Y, Y));
       } /* End of 'Max' function */
 
       /* Minimal vector function.
@@ -519,7 +533,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec2 Min( const vec2 &V ) const noexcept
       {
-        return vec2(min(V.X, X), min(V.Y, Y));
+        return vec2(std::min(V.X, X), std::min(V.Y, Y));
       } /* End of 'Min' function */
 
       /* Vector ceiling function.
@@ -532,7 +546,9 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec2 Ceil( void ) const noexcept
       {
-        return vec2(std::ceil(X), std::ceil(Y));
+        using std::ceil;
+
+        return vec2(ceil(X), ceil(Y));
       } /* End of 'Ceil' function */
 
       /* Vector flooring function.
@@ -545,7 +561,9 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec2 Floor( void ) const noexcept
       {
-        return vec2(std::floor(X), std::floor(Y));
+        using std::floor;
+
+        return vec2(floor(X), floor(Y));
       } /* End of 'Floor' function */
 
       /* Get shortest angle between vectors function.
@@ -1,12 +1,13 @@
 /***************************************************************
  * FILE NAME   : mth_def.h
  * PURPOSE     : Vector 3D class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_vec3_h_
 #define __mth_vec3_h_
 
+#include <algorithm>
 #include <format>
 
 #include "mth_def.h"
@@ -24,7 +25,7 @@ namespace mth
   template<typename Type>
     class vec3
     {
-      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in vec3");
+      static_assert(number<Type>, "Number type is needed in vec3");
 
     public:
       Type X, Y, Z;
@@ -97,6 +98,19 @@ namespace mth
       {
       } /* End of 'vec3' constructor */
 
+      /* Vector pointer cast function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (const Type *) result pointer.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr operator const Type *( void ) const noexcept
+      {
+        return &X;
+      } /* End of 'operator const Type *' function */
+
       /* Vector pointer cast function.
        * ARGUMENTS: None.
        * RETURNS:
@@ -105,10 +119,10 @@ namespace mth
 #ifdef __CUDA__
       __host__ __device__
 #endif /* __CUDA__ */
-      constexpr operator Type*( void ) const noexcept
+      constexpr operator Type *( void ) noexcept
       {
         return &X;
-      } /* End of 'operator Type*' function */
+      } /* End of 'operator Type *' function */
 
       /* Vector component getter function.
        * ARGUMENTS:
@@ -489,7 +503,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr Type MaxC( void ) const noexcept
       {
-        return max(max(X, Y), Z);
+        return std::max(std::max(X, Y), Z);
       } /* End of 'MaxC' function */
 
       /* Get vector minimal component function.
@@ -502,7 +516,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr Type MinC( void ) const noexcept
       {
-        return min(min(X, Y), Z);
+        return std::min(std::min(X, Y), Z);
       } /* End of 'MinC' function */
 
       /* Get distance between vectors' ends function.
@@ -535,9 +549,9 @@ namespace mth
       constexpr vec3 Lerp( const vec3 &V, const Type T ) const noexcept
       {
         return vec3(
-          std::lerp(X, V.X, T),
-          std::lerp(Y, V.Y, T),
-          std::lerp(Z, V.Z, T));
+          X + (V.X - X) * T,
+          Y + (V.Y - Y) * T,
+          Z + (V.Z - Z) * T);
       } /* End of 'Lerp' function */
 
       /* Maximal vector function.
@@ -552,7 +566,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec3 Max( const vec3 &V ) const noexcept
       {
-        return vec3(max(V.X, X), max(V.Y, Y), max(V.Z, Z));
+        return vec3(std::max(V.X, X), std::max(V.Y, Y), std::max(V.Z, Z));
       } /* End of 'Max' function */
 
       /* Minimal vector function.
@@ -567,7 +581,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec3 Min( const vec3 &V ) const noexcept
       {
-        return vec3(min(V.X, X), min(V.Y, Y), min(V.Z, Z));
+        return vec3(std::min(V.X, X), std::min(V.Y, Y), std::min(V.Z, Z));
       } /* End of 'Min' function */
 
       /* Vector ceiling function.
@@ -580,7 +594,9 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec3 Ceil( void ) const noexcept
       {
-        return vec3(std::ceil(X), std::ceil(Y), std::ceil(Z));
+        using std::ceil;
+
+        return vec3(ceil(X), ceil(Y), ceil(Z));
       } /* End of 'Ceil' function */
 
       /* Vector flooring function.
@@ -593,7 +609,9 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec3 Floor( void ) const noexcept
       {
-        return vec3(std::floor(X), std::floor(Y), std::floor(Z));
+        using std::floor;
+
+        return vec3(floor(X), floor(Y), floor(Z));
       } /* End of 'Floor' function */
 
       /* Get shortest angle between vectors function.
@@ -684,7 +702,7 @@ namespace mth
 #ifdef __CUDA__
       __host__ __device__
 #endif /* __CUDA__ */
-      constexpr int Index3D( const vec3<int> &Size ) const noexcept
+      constexpr int Index3D( const vec3<int> &Size ) const noexcept requires std::is_arithmetic_v<Type>
       {
         return Size.X * (static_cast<int>(Y) * Size.Z + static_cast<int>(Z)) + static_cast<int>(X);
       } /* End of 'Index3D' function */
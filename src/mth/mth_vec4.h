@@ -1,12 +1,13 @@
 /***************************************************************
  * FILE NAME   : mth_def.h
  * PURPOSE     : Vector 4D class module.
- * LAST UPDATE : 04.02.2025
+ * LAST UPDATE : 18.10.2026
  ***************************************************************/
 
 #ifndef __mth_vec4_h_
 #define __mth_vec4_h_
 
+#include <algorithm>
 #include <algorithm>
 #include <format>
 
@@ -25,7 +26,7 @@ namespace mth
   template<typename Type>
     class vec4
     {
-      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in vec4");
+      static_assert(number<Type>, "Number type is needed in vec4");
     public:
       Type X, Y, Z, W;
 
@@ -102,6 +103,19 @@ namespace mth
       {
       } /* End of 'vec4' constructor */
 
+      /* Vector pointer cast function.
+       * ARGUMENTS: None.
+       * RETURNS:
+       *   (const Type *) result pointer.
+       */
+#ifdef __CUDA__
+      __host__ __device__
+#endif /* __CUDA__ */
+      constexpr operator const Type *( void ) const noexcept
+      {
+        return &X;
+      } /* End of 'operator const Type *' function */
+
       /* Vector pointer cast function.
        * ARGUMENTS: None.
        * RETURNS:
@@ -110,10 +124,10 @@ namespace mth
 #ifdef __CUDA__
       __host__ __device__
 #endif /* __CUDA__ */
-      constexpr operator Type*( void ) const noexcept
+      constexpr operator Type *( void ) noexcept
       {
         return &X;
-      } /* End of 'operator Type*' function */
+      } /* End of 'operator Type *' function */
 
       /* Vector component getter function.
        * ARGUMENTS:
@@ -462,7 +476,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr Type MaxC( void ) const noexcept
       {
-        return max(max(X, Y), max(Z, W));
+        return std::max(std::max(X, Y), std::max(Z, W));
       } /* End of 'MaxC' function */
 
       /* Get vector minimal component function.
@@ -475,7 +489,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr Type MinC( void ) const noexcept
       {
-        return min(min(X, Y), min(Z, W));
+        return std::min(std::min(X, Y), std::min(Z, W));
       } /* End of 'MinC' function */
 
       /* Get distance between vectors' ends function.
@@ -508,10 +522,10 @@ namespace mth
       constexpr vec4 Lerp( const vec4 &V, const Type T ) const noexcept
       {
         return vec4(
-          std::lerp(X, V.X, T),
-          std::lerp(Y, V.Y, T),
-          std::lerp(Z, V.Z, T),
-          std::lerp(W, V.W, T));
+          X + (V.X - X) * T,
+          Y + (V.Y - Y) * T,
+          Z + (V.Z - Z) * T,
+          W + (V.W - W) * T);
       } /* End of 'Lerp' function */
 
       /* Maximal vector function.
@@ -526,7 +540,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec4 Max( const vec4 &V ) const noexcept
       {
-        return vec4(max(V.X, X), max(V.Y, Y), max(V.Z, Z), max(W, V.W));
+        return vec4(std::max(V.X, X), std::max(V.Y, Y), std::max(V.Z, Z), std::max(W, V.W));
       } /* End of 'Max' function */
 
       /* Minimal vector function.
@@ -541,7 +555,7 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec4 Min( const vec4 &V ) const noexcept
       {
-        return vec4(min(V.X, X), min(V.Y, Y), min(V.Z, Z), min(W, V.W));
+        return vec4(std::min(V.X, X), std::min(V.Y, Y), std::min(V.Z, Z), std::min(W, V.W));
       } /* End of 'Min' function */
 
       /* Vector ceiling function.
@@ -554,7 +568,9 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec4 Ceil( void ) const noexcept
       {
-        return vec4(std::ceil(X), std::ceil(Y), std::ceil(Z), std::ceil(W));
+        using std::ceil;
+
+        return vec4(ceil(X), ceil(Y), ceil(Z), ceil(W));
       } /* End of 'Ceil' function */
 
       /* Vector flooring function.
@@ -567,7 +583,9 @@ namespace mth
 #endif /* __CUDA__ */
       constexpr vec4 Floor( void ) const noexcept
       {
-        return vec4(std::floor(X), std::floor(Y), std::floor(Z), std::floor(W));
+        using std::floor;
+
+        return vec4(floor(X), floor(Y), floor(Z), floor(W));
       } /* End of 'Floor' function */
 
       /* Get vector volume function.
@@ -591,7 +609,7 @@ namespace mth
 #ifdef __CUDA__
       __host__ __device__
 #endif /* __CUDA__ */
-      constexpr DWORD CreateColor( void ) const noexcept
+      constexpr DWORD CreateColor( void ) const noexcept requires std::is_arithmetic_v<Type>
       {
         return ((DWORD)(((BYTE)(std::clamp<Type>(Z, 0, 1) * 255) |
                ((WORD)((BYTE)(std::clamp<Type>(Y, 0, 1) * 255)) << 8)) |
@@ -0,0 +1,474 @@
+/***************************************************************
+ * FILE NAME   : mth_wbvh.h
+ * PURPOSE     : Compressed wide bounding volume hierarchy class module.
+ * LAST UPDATE : 18.10.2026
+ ***************************************************************/
+
+#ifndef __mth_wbvh_h_
+#define __mth_wbvh_h_
+
+#include <bit>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "mth_def.h"
+#include "mth_simd.h"
+#include "mth_bvh.h"
+
+/* Math namespace */
+namespace mth
+{
+  /* Forward declaration */
+  template<typename Type>
+    class vec3;
+  template<typename Type>
+    class ray;
+
+  /* Compressed wide bounding volume hierarchy class.
+   * Binary 'bvh' collapsed to nodes with up to N (4 or 8) children, children
+   * boxes are quantized to 8 bits on power of two grid over parent box
+   * (80-88 bytes per 8 children instead of 224 bytes of binary nodes).
+   * All children boxes of node are tested against ray by one SIMD pass.
+   */
+  template<typename Type, int N = 8>
+    class wbvh
+    {
+      static_assert(std::is_arithmetic_v<Type>, "Number type is needed in wbvh");
+      static_assert(N == 4 || N == 8, "4 or 8 children are supported in wbvh");
+
+    public:
+      static const int SIZE = N;
+      static const int MAX_LEAF = 255 / N;              // Maximal primitives count in one child leaf
+      static const int STACK_SIZE = bvh<Type>::MAX_DEPTH * N; // Traversal stack size
+
+      using hit = typename bvh<Type>::hit;
+
+      /* Tree node representation type */
+      struct node
+      {
+        vec3<Type> Origin;           /* Quantization grid origin (node box minimal corner) */
+        signed char Exp[3];          /* Quantization grid step exponents (step = 2 ^ Exp, normal FLT range) */
+        unsigned char InnerMask;     /* Children which are inner nodes bits */
+        UINT ChildBase;              /* First child node index (inner children are stored contiguously) */
+        UINT PrimBase;               /* First primitive index in 'Ind' array (leaves children) */
+        unsigned char Child[N];      /* Inner child: node offset from 'ChildBase', leaf child: primitive offset from 'PrimBase' */
+        unsigned char Count[N];      /* Leaf child primitives count (0 for inner and empty children) */
+        unsigned char QMin[3][N];    /* Quantized children boxes minimal corners (per axis) */
+        unsigned char QMax[3][N];    /* Quantized children boxes maximal corners (per axis) */
+      }; /* End of 'node' structure */
+
+      std::vector<node> Nodes; // Tree nodes (root is first)
+      std::vector<int> Ind;    // Primitives indices in leaves order
+
+    private:
+      /* Collapse item (binary subtree or primitives range) representation type */
+      struct item
+      {
+        vec3<Type> Min, Max; /* Item box */
+        UINT Node;           /* Binary inner node index */
+        int First, Count;    /* Primitives range in binary tree 'Ind' array (Count 0 for inner node) */
+      }; /* End of 'item' structure */
+
+      /* Get power of two function.
+       * ARGUMENTS:
+       *   - exponent:
+       *       const int E;
+       * RETURNS:
+       *   (Type) 2 ^ E.
+       */
+      static Type Pow2( const int E ) noexcept
+      {
+        if constexpr (std::is_same_v<Type, FLT> && std::numeric_limits<FLT>::is_iec559)
+          return std::bit_cast<FLT>(static_cast<UINT>(E + 127) << 23);
+        else if constexpr (std::is_same_v<Type, DBL> && std::numeric_limits<DBL>::is_iec559)
+          return std::bit_cast<DBL>(static_cast<unsigned long long>(E + 1023) << 52);
+        else
+          return static_cast<Type>(std::ldexp(1.0, E));
+      } /* End of 'Pow2' function */
+
+      /* Make item from binary tree node function.
+       * ARGUMENTS:
+       *   - binary tree:
+       *       const bvh<Type> &B;
+       *   - node index:
+       *       const UINT Node;
+       * RETURNS:
+       *   (item) result item.
+       */
+      static item MakeItem( const bvh<Type> &B, const UINT Node ) noexcept
+      {
+        const typename bvh<Type>::node &Nd = B.Nodes[Node];
+
+        if (Nd.IsLeaf())
+          return item {Nd.Min, Nd.Max, Node, static_cast<int>(Nd.Offset), static_cast<int>(Nd.Count)};
+        return item {Nd.Min, Nd.Max, Node, 0, 0};
+      } /* End of 'MakeItem' function */
+
+      /* Build node from item function.
+       * Item is expanded (largest area first) to at most N children:
+       * binary inner nodes are replaced by their children, oversized
+       * primitives ranges are halved (halves share the range box).
+       * ARGUMENTS:
+       *   - binary tree:
+       *       const bvh<Type> &B;
+       *   - node index:
+       *       const UINT NodeInd;
+       *   - item to store in node:
+       *       const item &It;
+       * RETURNS: None.
+       */
+      void Collapse( const bvh<Type> &B, const UINT NodeInd, const item &It )
+      {
+        item Items[N];
+        int Cnt = 1;
+
+        Items[0] = It;
+        while (true)
+        {
+          /* Leaf which fits node can not be expanded further */
+          if (Cnt == 1 && Items[0].Count > 0 && Items[0].Count <= MAX_LEAF)
+            break;
+
+          int Best = -1;
+          Type BestArea = -1;
+
+          if (Cnt < N)
+            for (int i = 0; i < Cnt; i++)
+              if (Items[i].Count == 0 || Items[i].Count > MAX_LEAF)
+              {
+                const Type A = box<Type>(Items[i].Min, Items[i].Max).Area();
+
+                if (A > BestArea)
+                  Best = i, BestArea = A;
+              }
+          if (Best < 0)
+            break;
+
+          const item Cur = Items[Best];
+
+          if (Cur.Count == 0)
+          {
+            Items[Best] = MakeItem(B, Cur.Node + 1);
+            Items[Cnt++] = MakeItem(B, B.Nodes[Cur.Node].Offset);
+          }
+          else
+          {
+            Items[Best].Count = Cur.Count / 2;
+            Items[Cnt++] = item {Cur.Min, Cur.Max, Cur.Node, Cur.First + Cur.Count / 2, Cur.Count - Cur.Count / 2};
+          }
+        }
+
+        /* Node quantization grid */
+        box<Type> Bound = box<Type>::Empty();
+        node Nd {};
+
+        for (int i = 0; i < Cnt; i++)
+          Bound |= box<Type>(Items[i].Min, Items[i].Max);
+        Nd.Origin = Bound.Min;
+        for (int a = 0; a < 3; a++)
+        {
+          const Type Ext = Bound.Max[a] - Bound.Min[a];
+          int E = 0;
+
+          if (Ext > 0)
+          {
+            std::frexp(Ext / 255, &E);
+            E = E < -126 ? -126 : E > 127 ? 127 : E;
+          }
+          Nd.Exp[a] = static_cast<signed char>(E);
+        }
+
+        /* Quantize children boxes (conservatively) and place children */
+        int Prims = 0;
+
+        Nd.ChildBase = static_cast<UINT>(Nodes.size());
+        Nd.PrimBase = static_cast<UINT>(Ind.size());
+        for (int i = 0; i < N; i++)
+        {
+          if (i >= Cnt)
+          {
+            /* Empty child (not inner, no primitives) is masked out in traversal */
+            for (int a = 0; a < 3; a++)
+              Nd.QMin[a][i] = Nd.QMax[a][i] = 0;
+            continue;
+          }
+          for (int a = 0; a < 3; a++)
+          {
+            const Type Step = Pow2(Nd.Exp[a]);
+            int Lo = static_cast<int>(std::floor((Items[i].Min[a] - Nd.Origin[a]) / Step));
+            int Hi = static_cast<int>(std::ceil((Items[i].Max[a] - Nd.Origin[a]) / Step));
+
+            Lo = Lo < 0 ? 0 : Lo > 255 ? 255 : Lo;
+            Hi = Hi < 0 ? 0 : Hi > 255 ? 255 : Hi;
+            while (Lo > 0 && Nd.Origin[a] + Lo * Step > Items[i].Min[a])
+              Lo--;
+            while (Hi < 255 && Nd.Origin[a] + Hi * Step < Items[i].Max[a])
+              Hi++;
+            Nd.QMin[a][i] = static_cast<unsigned char>(Lo);
+            Nd.QMax[a][i] = static_cast<unsigned char>(Hi);
+          }
+          if (Items[i].Count == 0 || Items[i].Count > MAX_LEAF)
+          {
+            Nd.InnerMask |= 1 << i;
+            Nd.Child[i] = static_cast<unsigned char>(Nodes.size() - Nd.ChildBase);
+            Nodes.emplace_back();
+          }
+          else
+          {
+            Nd.Child[i] = static_cast<unsigned char>(Prims);
+            Nd.Count[i] = static_cast<unsigned char>(Items[i].Count);
+            Ind.insert(Ind.end(), B.Ind.begin() + Items[i].First, B.Ind.begin() + Items[i].First + Items[i].Count);
+            Prims += Items[i].Count;
+          }
+        }
+        Nodes[NodeInd] = Nd;
+
+        /* Build inner children */
+        for (int i = 0; i < Cnt; i++)
+          if (Nd.InnerMask & (1 << i))
+            Collapse(B, Nd.ChildBase + Nd.Child[i], Items[i]);
+      } /* End of 'Collapse' function */
+
+    public:
+      /* Class default constructor */
+      wbvh( void ) = default;
+
+      /* Class constructor (collapses binary tree).
+       * ARGUMENTS:
+       *   - binary tree:
+       *       const bvh<Type> &B;
+       */
+      wbvh( const bvh<Type> &B )
+      {
+        Build(B);
+      } /* End of 'wbvh' function */
+
+      /* Build tree from binary tree function.
+       * ARGUMENTS:
+       *   - binary tree:
+       *       const bvh<Type> &B;
+       * RETURNS:
+       *   (wbvh &) self reference.
+       */
+      wbvh & Build( const bvh<Type> &B )
+      {
+        Nodes.clear();
+        Ind.clear();
+        if (B.Nodes.empty())
+          return *this;
+        Nodes.reserve(B.Nodes.size() / (N - 1) + 1);
+        Ind.reserve(B.Ind.size());
+        Nodes.emplace_back();
+        Collapse(B, 0, MakeItem(B, 0));
+        Nodes.shrink_to_fit();
+        return *this;
+      } /* End of 'Build' function */
+
+      /* Intersect ray with all node children boxes function.
+       * ARGUMENTS:
+       *   - node index:
+       *       const UINT NodeInd;
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - distances range:
+       *       const Type TMin, TMax;
+       *   - children boxes entry distances (valid for hit children only):
+       *       simd<Type, N> &TNear;
+       * RETURNS:
+       *   (UINT) hit children bits.
+       */
+      UINT IntersectChildren( const UINT NodeInd, const ray<Type> &R, const Type TMin, const Type TMax, simd<Type, N> &TNear ) const noexcept
+      {
+        constexpr Type
+          Eps = std::numeric_limits<Type>::epsilon() / 2,
+          Robust = 1 + 2 * (3 * Eps / (1 - 3 * Eps));
+        const node &Nd = Nodes[NodeInd];
+        simd<Type, N> t0(TMin), t1(TMax);
+
+        for (int a = 0; a < 3; a++)
+        {
+          const bool Neg = R.DirSign & (1 << a);
+          const simd<Type, N>
+            Step(Pow2(Nd.Exp[a])),
+            Base(Nd.Origin[a] - R.Org[a]),
+            Inv(R.InvDir[a]),
+            tn = (simd<Type, N>::LoadBytes(Neg ? Nd.QMax[a] : Nd.QMin[a]) * Step + Base) * Inv,
+            tf = (simd<Type, N>::LoadBytes(Neg ? Nd.QMin[a] : Nd.QMax[a]) * Step + Base) * Inv * simd<Type, N>(Robust);
+
+          /* Comparisons with NaN are false, so interval value is kept */
+          t0 = Select(tn > t0, tn, t0);
+          t1 = Select(tf < t1, tf, t1);
+        }
+        UINT Valid = Nd.InnerMask;
+
+        for (int i = 0; i < N; i++)
+          Valid |= (Nd.Count[i] != 0) << i;
+        TNear = t0;
+        return (t0 <= t1).Bits() & Valid;
+      } /* End of 'IntersectChildren' function */
+
+      /* Find closest intersection function.
+       * ARGUMENTS:
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - intersection result (T must be set to maximal distance, updated on hit):
+       *       hit &Hit;
+       *   - primitive intersection function (called as F(PrimIndex, R), returns distance or -1):
+       *       const Func &F;
+       * RETURNS:
+       *   (bool) true if hit found.
+       */
+      template<typename Func>
+        bool Intersect( const ray<Type> &R, hit &Hit, const Func &F ) const
+        {
+          return Traverse<false>(R, Hit, F, 0);
+        } /* End of 'Intersect' function */
+
+      /* Find any intersection function (stops at first found hit).
+       * ARGUMENTS:
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - intersection result (T must be set to maximal distance, updated on hit):
+       *       hit &Hit;
+       *   - primitive intersection function (called as F(PrimIndex, R), returns distance or -1):
+       *       const Func &F;
+       * RETURNS:
+       *   (bool) true if hit found.
+       */
+      template<typename Func>
+        bool IntersectAny( const ray<Type> &R, hit &Hit, const Func &F ) const
+        {
+          return Traverse<true>(R, Hit, F, 0);
+        } /* End of 'IntersectAny' function */
+
+      /* Occlusion query function (stops at first hit in distances range).
+       * ARGUMENTS:
+       *   - ray to test:
+       *       const ray<Type> &R;
+       *   - distances range [TMin, TMax] (negative TMin is same as 0, so misses never occlude):
+       *       const Type TMin, TMax;
+       *   - primitive intersection function (called as F(PrimIndex, R), returns distance or -1):
+       *       const Func &F;
+       * RETURNS:
+       *   (bool) true if ray is occluded.
+       */
+      template<typename Func>
+        bool Occluded( const ray<Type> &R, const Type TMin, const Type TMax, const Func &F ) const
+        {
+          hit Hit {std::nextafter(TMax, std::numeric_limits<Type>::infinity()), -1};
+
+          return Traverse<true>(R, Hit, F, Max(TMin, Type(0)));
+        } /* End of 'Occluded' function */
+
+    private:
+      /* Traverse tree function.
+       * Hit children are processed in order of entry distances: leaves
+       * primitives are intersected at once, inner nodes are pushed to stack.
+       * ARGUMENTS:
+       *   - ray to intersect:
+       *       const ray<Type> &R;
+       *   - intersection result:
+       *       hit &Hit;
+       *   - primitive intersection function:
+       *       const Func &F;
+       *   - minimal distance:
+       *       const Type TMin;
+       * RETURNS:
+       *   (bool) true if hit found.
+       */
+      template<bool IsAnyHit, typename Func>
+        bool Traverse( const ray<Type> &R, hit &Hit, const Func &F, const Type TMin ) const
+        {
+          if (Nodes.empty())
+            return false;
+
+          /* Stack entry: node index and its box entry distance */
+          struct entry
+          {
+            UINT Node;
+            Type T;
+          } Stack[STACK_SIZE];
+          int Sp = 0;
+          bool IsFound = false;
+
+          UINT Cur = 0;
+
+          while (true)
+          {
+            const node &Nd = Nodes[Cur];
+            simd<Type, N> TNear;
+            UINT Bits = IntersectChildren(Cur, R, TMin, Hit.T, TNear);
+
+            /* Sort hit children by distance (insertion sort, nearest first) */
+            int Order[N], Cnt = 0;
+
+            for (int i = 0; Bits != 0; i++, Bits >>= 1)
+              if (Bits & 1)
+              {
+                int j = Cnt++;
+
+                for (; j > 0 && TNear[Order[j - 1]] > TNear[i]; j--)
+                  Order[j] = Order[j - 1];
+                Order[j] = i;
+              }
+
+            /* Intersect leaves */
+            for (int k = 0; k < Cnt; k++)
+            {
+              const int i = Order[k];
+
+              if (Nd.InnerMask & (1 << i) || TNear[i] > Hit.T)
+                continue;
+              for (int p = 0; p < Nd.Count[i]; p++)
+              {
+                const int P = Ind[Nd.PrimBase + Nd.Child[i] + p];
+                const Type T = F(P, R);
+
+                if (T >= TMin && T < Hit.T)
+                {
+                  Hit.T = T;
+                  Hit.Prim = P;
+                  IsFound = true;
+                  if constexpr (IsAnyHit)
+                    return true;
+                }
+              }
+            }
+
+            /* Push inner nodes (farthest first), continue with nearest one */
+            int Next = -1;
+
+            for (int k = Cnt - 1; k >= 0; k--)
+            {
+              const int i = Order[k];
+
+              if (Nd.InnerMask & (1 << i) && TNear[i] <= Hit.T)
+              {
+                if (Next >= 0)
+                  Stack[Sp++] = entry {Nd.ChildBase + Nd.Child[Next], TNear[Next]};
+                Next = i;
+              }
+            }
+            if (Next >= 0)
+            {
+              Cur = Nd.ChildBase + Nd.Child[Next];
+              continue;
+            }
+
+            /* Pop nearest subtree not culled by found hit */
+            while (Sp > 0 && Stack[Sp - 1].T > Hit.T)
+              Sp--;
+            if (Sp == 0)
+              break;
+            Cur = Stack[--Sp].Node;
+          }
+          return IsFound;
+        } /* End of 'Traverse' function */
+
+    }; /* End of 'wbvh' class */
+} /* end of 'mth' namespace */
+
+#endif /* __mth_wbvh_h_ */
+
+/* END OF 'mth_wbvh.h' FILE */